@@ -35,4 +35,8 @@ end
 
 -- BOP_GENERATED_FUNCTIONS_END
 
+-- BOP_GENERATED_FUNCTION_TABLE_BEGIN
+
+-- BOP_GENERATED_FUNCTION_TABLE_END
+
 return ConversationGraphName
@@ -2,9 +2,16 @@
 
 #include "AzCore/EBus/EBus.h"
 #include "AzCore/RTTI/BehaviorContext.h"
+#include "AzCore/std/containers/vector.h"
+#include "AzCore/std/string/string.h"
 
 namespace Conversation
 {
+    //! Bit i is set when the i-th ID of a batched check is available.
+    using AvailabilityMask = AZ::u32;
+    //! How many IDs one batched availability check can answer.
+    constexpr size_t MaxAvailabilityBatchSize{ sizeof(AvailabilityMask) * 8 };
+
     class AvailabilityRequests : public AZ::EBusTraits
     {
     public:
@@ -20,6 +27,50 @@ namespace Conversation
         {
             return false;
         }
+
+        /**
+         * @brief Checks up to MaxAvailabilityBatchSize IDs in one call.
+         *
+         * The default asks IsAvailable once per ID. Handlers that cross into
+         * script should answer the whole batch at once instead.
+         *
+         * @returns A mask with bit i set if availabilityIds[i] is available.
+         * IDs past MaxAvailabilityBatchSize are never available.
+         */
+        virtual auto AreAvailable(
+            AZStd::vector<AZStd::string> const& availabilityIds)
+            -> AvailabilityMask
+        {
+            AvailabilityMask mask{};
+            auto const count =
+                AZStd::min(availabilityIds.size(), MaxAvailabilityBatchSize);
+            for (size_t bit{}; bit < count; ++bit)
+            {
+                if (IsAvailable(availabilityIds[bit]))
+                {
+                    mask |= AvailabilityMask{ 1 } << bit;
+                }
+            }
+
+            return mask;
+        }
+
+        /**
+         * @brief Checks a batch using the companion script's function table.
+         *
+         * scriptIndices[i] is where availabilityIds[i]'s check is in the
+         * table, or DialogueData::NoScriptIndex if it isn't in it. The
+         * default ignores the indices and calls AreAvailable.
+         *
+         * @returns A mask with bit i set if availabilityIds[i] is available.
+         */
+        virtual auto AreAvailableByIndex(
+            [[maybe_unused]] AZStd::vector<AZ::u32> const& scriptIndices,
+            AZStd::vector<AZStd::string> const& availabilityIds)
+            -> AvailabilityMask
+        {
+            return AreAvailable(availabilityIds);
+        }
     };
 
     using AvailabilityRequestBus = AZ::EBus<AvailabilityRequests>;
@@ -33,7 +84,9 @@ namespace Conversation
             BehaviorAvailabilityRequestBusHandler,
             "{D6037DA0-68CD-40F3-AB56-C91A6E7F4C3D}",
             AZ::SystemAllocator,
-            IsAvailable);
+            IsAvailable,
+            AreAvailable,
+            AreAvailableByIndex);
 
         auto IsAvailable(AZStd::string_view const availabilityId)
             -> bool override
@@ -42,5 +95,41 @@ namespace Conversation
             CallResult(result, FN_IsAvailable, availabilityId);
             return result;
         }
+
+        auto AreAvailable(AZStd::vector<AZStd::string> const& availabilityIds)
+            -> AvailabilityMask override
+        {
+            // Scripts that don't implement the batch still answer one ID at a
+            // time.
+            if (GetEvents()[FN_AreAvailable].m_function == nullptr)
+            {
+                return AvailabilityRequests::AreAvailable(availabilityIds);
+            }
+
+            AvailabilityMask result{};
+            CallResult(result, FN_AreAvailable, availabilityIds);
+            return result;
+        }
+
+        auto AreAvailableByIndex(
+            AZStd::vector<AZ::u32> const& scriptIndices,
+            AZStd::vector<AZStd::string> const& availabilityIds)
+            -> AvailabilityMask override
+        {
+            // Scripts that weren't generated with a function table only know
+            // their checks by name.
+            if (GetEvents()[FN_AreAvailableByIndex].m_function == nullptr)
+            {
+                return AreAvailable(availabilityIds);
+            }
+
+            AvailabilityMask result{};
+            CallResult(
+                result,
+                FN_AreAvailableByIndex,
+                scriptIndices,
+                availabilityIds);
+            return result;
+        }
     };
 } // namespace Conversation
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "AzCore/Memory/SystemAllocator.h"
+#include "AzCore/std/containers/unordered_map.h"
+#include "AzCore/std/containers/vector.h"
+#include "AzCore/std/functional.h"
+#include "AzCore/std/parallel/mutex.h"
+#include "AzCore/std/smart_ptr/enable_shared_from_this.h"
+#include "AzCore/std/smart_ptr/make_shared.h"
+#include "AzCore/std/string/string.h"
+
+#include "Conversation/ConversationAssetFormat.h"
+#include "Conversation/DialogueHandle.h"
+
+namespace Conversation
+{
+    /**
+     * @brief Streams dialogue chunk text in from a separate product.
+     *
+     * A conversation's structure stays resident while its chunk text, which
+     * is most of its size, stays on disk until a dialogue needs it. Text is
+     * read through AZ::IO::Streamer and reference counted, so several
+     * speakers sharing an asset can hold the same text.
+     *
+     * Reads complete on the streamer's thread. Callers that need to touch
+     * components should queue their work back onto the main thread.
+     */
+    class ChunkTextStore
+        : public AZStd::enable_shared_from_this<ChunkTextStore>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ChunkTextStore, AZ::SystemAllocator, 0); // NOLINT
+        AZ_DISABLE_COPY_MOVE(ChunkTextStore); // NOLINT
+
+        //! Called once every requested dialogue's text is available.
+        using OnLoadedCallback = AZStd::function<void()>;
+
+        /**
+         * @param streamName The file the text product is read from.
+         * @param baseOffset Where the text product begins in that file.
+         * @param chunkRefs The location of each dialogue's text, by index.
+         */
+        ChunkTextStore(
+            AZStd::string streamName,
+            AZ::u64 baseOffset,
+            AZStd::vector<AssetFormat::StringRef> chunkRefs);
+        ~ChunkTextStore() = default;
+
+        /**
+         * @brief Starts loading the text of the given dialogues.
+         *
+         * Each index is held until a matching Release(). The callback is run
+         * immediately if everything is already loaded.
+         */
+        void Load(
+            AZStd::span<DialogueIndex const> indices,
+            OnLoadedCallback onLoaded);
+
+        //! Drops one hold on each dialogue's text.
+        void Release(AZStd::span<DialogueIndex const> indices);
+
+        [[nodiscard]] auto IsLoaded(DialogueIndex index) const -> bool;
+
+        /**
+         * @brief Returns a dialogue's text if it has been loaded.
+         *
+         * The text stays valid until the last hold on it is released.
+         */
+        [[nodiscard]] auto Find(DialogueIndex index) const
+            -> AZStd::string_view;
+
+    private:
+        struct PendingLoad
+        {
+            size_t m_remaining{};
+            OnLoadedCallback m_onLoaded;
+        };
+
+        struct Entry
+        {
+            AZStd::string m_text;
+            AZ::u32 m_holds{};
+            bool m_isLoaded{};
+            bool m_isReading{};
+            AZStd::vector<AZStd::shared_ptr<PendingLoad>> m_waiters;
+        };
+
+        void StartRead(DialogueIndex index, Entry& entry);
+        void OnReadComplete(DialogueIndex index, bool succeeded);
+        //! Must be called with m_mutex unlocked.
+        static void Finish(
+            AZStd::vector<AZStd::shared_ptr<PendingLoad>> const& loads);
+
+        AZStd::string m_streamName;
+        AZ::u64 m_baseOffset{};
+        AZStd::vector<AssetFormat::StringRef> m_chunkRefs;
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<DialogueIndex, Entry> m_entries;
+    };
+} // namespace Conversation
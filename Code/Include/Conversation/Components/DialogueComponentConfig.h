@@ -40,5 +40,27 @@ namespace Conversation
         AZStd::string m_speakerTag{};
         /** The entity's display name*/
         AZStd::string m_displayName{};
+        /**
+         * Work out what each response would lead to while the player reads
+         * the current dialogue, so that selecting one is only a commit.
+         */
+        bool m_precomputeNextLevel{};
+        /**
+         * Hold conversation notifications back and send them once per tick,
+         * instead of from inside the call that caused them.
+         */
+        bool m_queueNotifications{};
+        /**
+         * Remember each availability check's answer until the world state
+         * epoch moves. Only correct if the game bumps the epoch whenever
+         * something the checks depend on changes.
+         */
+        bool m_cacheAvailability{};
+        /**
+         * Also tag the entity while it's in a conversation, for anything that
+         * still looks for the conversation tags. The conversation system
+         * tracks active conversations either way.
+         */
+        bool m_mirrorConversationTags{ true };
     };
 } // namespace Conversation
@@ -2,8 +2,14 @@
 
 #include "AzCore/Asset/AssetCommon.h"
 #include "AzCore/Script/ScriptAsset.h"
+#include "AzCore/std/containers/unordered_map.h"
+#include "AzCore/std/functional.h"
 #include "AzFramework/Asset/GenericAssetHandler.h"
+#include "Conversation/ChunkTextStore.h"
+#include "Conversation/ConversationAssetFormat.h"
 #include "Conversation/DialogueData.h"
+#include "Conversation/DialogueHandle.h"
+#include "Conversation/DialogueLookupTable.h"
 #include "Conversation/IConversationAsset.h"
 
 namespace Conversation
@@ -22,6 +28,10 @@ namespace Conversation
         AZ_DISABLE_COPY_MOVE(ConversationAsset); // NOLINT
 
         using StartingIdContainer = AZStd::vector<UniqueId>;
+        using DialogueIndexTable =
+            AZStd::unordered_map<UniqueId, DialogueIndex>;
+        using ResponseOffsetContainer = AZStd::vector<AZ::u32>;
+        using ResponseIndexContainer = AZStd::vector<DialogueIndex>;
 
         static void Reflect(AZ::ReflectContext* context);
 
@@ -37,6 +47,35 @@ namespace Conversation
         static constexpr auto SourceDotExtension = ".conversation";
 
         static constexpr auto ProductAssetSubId = 1;
+        //! The sub ID of the product that keeps the data StripEditorData()
+        //! removes from the runtime product.
+        static constexpr auto DebugProductAssetSubId = 2;
+        static constexpr auto DebugProductDotExtension = ".conversationdebug";
+        //! The sub ID of the product holding streamed chunk text.
+        static constexpr auto ChunkTextProductAssetSubId = 3;
+        static constexpr auto ChunkTextProductDotExtension =
+            ".conversationtext";
+
+        /**
+         * @brief Returns the ID of the debug sidecar for a runtime product.
+         *
+         * The sidecar is a complete ConversationAsset. Nothing depends on it,
+         * so it is only bundled or loaded when explicitly requested, such as
+         * by the editor or a debug build.
+         */
+        [[nodiscard]] static auto GetDebugAssetId(
+            AZ::Data::AssetId const& productAssetId) -> AZ::Data::AssetId
+        {
+            return AZ::Data::AssetId{ productAssetId.m_guid,
+                                      DebugProductAssetSubId };
+        }
+
+        [[nodiscard]] static auto GetChunkTextAssetId(
+            AZ::Data::AssetId const& productAssetId) -> AZ::Data::AssetId
+        {
+            return AZ::Data::AssetId{ productAssetId.m_guid,
+                                      ChunkTextProductAssetSubId };
+        }
 
         [[nodiscard]] auto CountStartingIds() const -> size_t override
         {
@@ -48,12 +87,24 @@ namespace Conversation
             return m_dialogues.size();
         }
 
+        [[nodiscard]] auto GetStartingIds() const
+            -> AZStd::span<UniqueId const> override
+        {
+            return m_startingIds;
+        }
+
         [[nodiscard]] auto CopyStartingIds() const
             -> AZStd::vector<UniqueId> override
         {
             return m_startingIds;
         }
 
+        [[nodiscard]] auto GetDialogues() const
+            -> AZStd::span<DialogueData const> override
+        {
+            return m_dialogues;
+        }
+
         [[nodiscard]] auto CopyDialogues() const
             -> DialogueDataContainer override
         {
@@ -83,9 +134,122 @@ namespace Conversation
         [[nodiscard]] auto CheckDialogueExists(UniqueId const& dialogueId)
             -> bool override
         {
-            return m_dialogues.contains(DialogueData(dialogueId));
+            return GetDialogueIndex(dialogueId) != InvalidDialogueIndex;
+        }
+
+        /**
+         * @brief Returns the position of a dialogue in the dialogue table.
+         *
+         * Loaded assets use a perfect hash built with the product. Assets
+         * still being edited fall back to a hash map.
+         *
+         * @returns The index, or InvalidDialogueIndex if not found.
+         */
+        [[nodiscard]] auto GetDialogueIndex(UniqueId const& dialogueId) const
+            -> DialogueIndex
+        {
+            if (!m_dialogueLookup.IsEmpty())
+            {
+                return m_dialogueLookup.Find(dialogueId);
+            }
+
+            auto const iter = m_dialogueIndices.find(dialogueId);
+            return iter != m_dialogueIndices.end() ? iter->second
+                                                   : InvalidDialogueIndex;
+        }
+
+        /**
+         * @brief Returns the dialogue at the given table index.
+         *
+         * @warning The index must be less than CountDialogues().
+         */
+        [[nodiscard]] auto GetDialogueByIndex(DialogueIndex index) const
+            -> DialogueData const&
+        {
+            AZ_Assert( // NOLINT
+                index < m_dialogues.size(),
+                "Dialogue index %u is out of range.",
+                index);
+            return m_dialogues[index];
+        }
+
+        /**
+         * @brief Finds a dialogue without copying it.
+         *
+         * @returns A pointer into the dialogue table, or nullptr if there is
+         * no dialogue with the given ID. The pointer is invalidated by any
+         * call that adds a dialogue.
+         */
+        [[nodiscard]] auto GetDialogueHandle(UniqueId const& dialogueId) const
+            -> DialogueHandle override
+        {
+            return DialogueHandle{ this, GetDialogueIndex(dialogueId) };
+        }
+
+        [[nodiscard]] auto FindDialogue(UniqueId const& dialogueId) const
+            -> DialogueData const*
+        {
+            auto const index = GetDialogueIndex(dialogueId);
+            return index != InvalidDialogueIndex ? &m_dialogues[index]
+                                                 : nullptr;
+        }
+
+        /**
+         * @brief Rebuilds the ID to index table from the dialogue table.
+         *
+         * Only the dialogue table is serialized, so this is called once the
+         * asset has been read in. It builds the perfect hash unless the
+         * dialogue IDs repeat.
+         */
+        void RebuildDialogueIndices();
+
+        //! Returns the perfect hash, which is empty while the asset is edited.
+        [[nodiscard]] auto GetDialogueLookup() const
+            -> DialogueLookupTable const&
+        {
+            return m_dialogueLookup;
+        }
+
+        /**
+         * @brief Checks if the response graph matches the dialogue table.
+         *
+         * Adding a dialogue or response invalidates the graph until
+         * RebuildResponseGraph() is called. Loaded assets always have one.
+         */
+        [[nodiscard]] auto HasResponseGraph() const -> bool
+        {
+            return m_responseOffsets.size() == m_dialogues.size() + 1;
+        }
+
+        /**
+         * @brief Returns the table indices of a dialogue's responses.
+         *
+         * Response IDs that don't match a dialogue in this asset are left out.
+         *
+         * @warning HasResponseGraph() must be true and the index must be less
+         * than CountDialogues().
+         */
+        [[nodiscard]] auto GetResponseIndices(DialogueIndex index) const
+            -> AZStd::span<DialogueIndex const>
+        {
+            AZ_Assert( // NOLINT
+                HasResponseGraph() && index < m_dialogues.size(),
+                "Response graph lookup for dialogue index %u is invalid.",
+                index);
+            return AZStd::span<DialogueIndex const>(
+                m_responseIndices.data() + m_responseOffsets[index],
+                m_responseOffsets[index + 1] - m_responseOffsets[index]);
         }
 
+        /**
+         * @brief Resolves every dialogue's response IDs into table indices.
+         *
+         * The result is stored in compressed sparse row form: the responses
+         * of dialogue i are m_responseIndices[m_responseOffsets[i]] up to
+         * m_responseIndices[m_responseOffsets[i + 1]].
+         */
+        void RebuildResponseGraph();
+
         [[nodiscard]] auto GetMainScriptAsset() const
             -> AZ::Data::Asset<AZ::ScriptAsset> override
         {
@@ -108,6 +272,109 @@ namespace Conversation
             m_mainScript = asset;
         }
 
+        /**
+         * @brief Checks if chunk text is streamed rather than resident.
+         *
+         * When it is, DialogueData::GetChunkAsText() is empty for this
+         * asset's dialogues. Use GetChunkText() once the text has been loaded
+         * through GetChunkTextStore().
+         */
+        [[nodiscard]] auto IsChunkTextStreamed() const -> bool
+        {
+            return !m_chunkTextRefs.empty();
+        }
+
+        /**
+         * @brief Sets where streamed chunk text is read from.
+         *
+         * Called by the asset handler once it has located the text product.
+         */
+        void SetChunkTextSource(AZStd::string streamName, AZ::u64 baseOffset);
+
+        //! Returns the text store, or nullptr if the text is resident.
+        [[nodiscard]] auto GetChunkTextStore() const
+            -> AZStd::shared_ptr<ChunkTextStore>
+        {
+            return m_chunkTextStore;
+        }
+
+        /**
+         * @brief Returns a dialogue's chunk text.
+         *
+         * @returns The text, or an empty string_view if the text is streamed
+         * and not currently loaded.
+         */
+        [[nodiscard]] auto GetChunkText(DialogueIndex index) const
+            -> AZStd::string_view;
+
+        /**
+         * @brief Resolves each dialogue's availability ID to the name that
+         *        availability handlers know it by.
+         *
+         * A name can only be found while something, such as the graph's node
+         * names, keeps it registered. Products store the resolved keys, so
+         * the NameDictionary is never needed once an asset is loaded.
+         */
+        void ResolveAvailabilityKeys();
+
+        //! Returns true if every dialogue has a resolved availability key.
+        [[nodiscard]] auto HasAvailabilityKeys() const -> bool
+        {
+            return m_availabilityKeyRefs.size() == m_dialogues.size();
+        }
+
+        /**
+         * @brief Returns the name a dialogue's availability is checked by.
+         *
+         * @returns The key, or an empty string_view if the keys aren't
+         * resolved or the dialogue has no availability ID.
+         */
+        [[nodiscard]] auto GetAvailabilityKey(DialogueIndex index) const
+            -> AZStd::string_view;
+
+        //! A dialogue without an audio trigger the audio system knows.
+        static constexpr AZ::u64 NoAudioTrigger{ 0 };
+
+        /**
+         * @brief Resolves each dialogue's audio control to the ID of the
+         *        audio system's trigger.
+         *
+         * Voice lines can then be played by ID, instead of the audio system
+         * looking their name up every time.
+         *
+         * @param resolve Returns a control's trigger ID, or NoAudioTrigger if
+         * the audio system doesn't know it. It isn't called for dialogues
+         * without an audio control.
+         * @returns The index of each dialogue whose control wasn't found.
+         */
+        auto ResolveAudioTriggers(
+            AZStd::function<AZ::u64(DialogueAudioControl const&)> const&
+                resolve) -> AZStd::vector<DialogueIndex>;
+
+        //! Returns true once ResolveAudioTriggers has run.
+        [[nodiscard]] auto HasAudioTriggerIds() const -> bool
+        {
+            return m_audioTriggerIds.size() == m_dialogues.size();
+        }
+
+        //! Returns NoAudioTrigger if the triggers aren't resolved.
+        [[nodiscard]] auto GetAudioTriggerId(DialogueIndex index) const
+            -> AZ::u64
+        {
+            return index < m_audioTriggerIds.size() ? m_audioTriggerIds[index]
+                                                    : NoAudioTrigger;
+        }
+
+        /**
+         * @brief Removes data that is only needed by tools.
+         *
+         * That is the comments, the graph's node names, and the response
+         * list, which duplicates the response IDs already stored on each
+         * dialogue. Availability keys are resolved first, while the node
+         * names are still around.
+         */
+        void StripEditorData();
+
         auto AddNames(AZStd::span<AZ::Name> names)
         {
             // TODO: Improve; maybe ranges, views, transform
@@ -120,18 +387,80 @@ namespace Conversation
         }
 
     private:
+        void BuildResponseGraph(
+            ResponseOffsetContainer& offsets,
+            ResponseIndexContainer& indices) const;
+        //! Returns each dialogue's ID hash, in dialogue table order.
+        [[nodiscard]] auto CollectDialogueIds() const -> AZStd::vector<AZ::u32>;
+        //! Fills m_dialogueIndices, keeping the first of any repeated IDs.
+        void RebuildDialogueIndexMap();
+
+        friend auto AssetFormat::WriteConversationAsset(
+            ConversationAsset const& asset,
+            AZ::IO::GenericStream& stream,
+            AZ::IO::GenericStream* chunkTextStream)
+            -> AZ::Outcome<void, AZStd::string>;
+        friend auto AssetFormat::ReadConversationAsset(
+            AZStd::span<AZ::u8 const> buffer, ConversationAsset& asset)
+            -> AZ::Outcome<void, AZStd::string>;
+
         //! The IDs of any dialogues that can be used to begin a conversation.
         StartingIdContainer m_startingIds{};
         AZStd::vector<ResponseData> m_responses;
         AZStd::unordered_set<DialogueChunk> m_chunks;
+        //! Every dialogue in the asset, stored contiguously.
         DialogueDataContainer m_dialogues{};
+        //! Maps a dialogue's ID to its position in m_dialogues.
+        DialogueLookupTable m_dialogueLookup{};
+        //! Used instead of m_dialogueLookup while dialogues are being added.
+        DialogueIndexTable m_dialogueIndices{};
+        //! Where each dialogue's responses begin in m_responseIndices.
+        ResponseOffsetContainer m_responseOffsets{};
+        //! The responses of every dialogue, stored back to back.
+        ResponseIndexContainer m_responseIndices{};
+        //! Where each dialogue's text is in the text product, if streamed.
+        AZStd::vector<AssetFormat::StringRef> m_chunkTextRefs{};
+        //! Every dialogue's availability key, back to back.
+        AZStd::string m_availabilityKeyText{};
+        //! Where each dialogue's key is in m_availabilityKeyText.
+        AZStd::vector<AssetFormat::StringRef> m_availabilityKeyRefs{};
+        //! Every dialogue's audio trigger ID, once resolved.
+        AZStd::vector<AZ::u64> m_audioTriggerIds{};
+        AZStd::shared_ptr<ChunkTextStore> m_chunkTextStore{};
         AZStd::string m_comment{};
         AZ::Data::Asset<AZ::ScriptAsset> m_mainScript{};
         AZStd::unordered_set<AZ::Name> m_names{};
     };
 
-    using ConversationAssetHandler =
-        AzFramework::GenericAssetHandler<ConversationAsset>;
+    /**
+     * Loads and saves conversation products in the binary layout described in
+     * ConversationAssetFormat.h.
+     *
+     * The whole product is read in one go and then fixed up in memory.
+     * Products built before the binary layout existed are still loaded
+     * through the SerializeContext.
+     */
+    class ConversationAssetHandler
+        : public AzFramework::GenericAssetHandler<ConversationAsset>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR( // NOLINT
+            ConversationAssetHandler,
+            AZ::SystemAllocator,
+            0);
+
+        using GenericAssetHandler::GenericAssetHandler;
+
+        auto LoadAssetData(
+            AZ::Data::Asset<AZ::Data::AssetData> const& asset,
+            AZStd::shared_ptr<AZ::Data::AssetDataStream> stream,
+            AZ::Data::AssetFilterCB const& assetLoadFilterCB)
+            -> AZ::Data::AssetHandler::LoadResult override;
+
+        auto SaveAssetData(
+            AZ::Data::Asset<AZ::Data::AssetData> const& asset,
+            AZ::IO::GenericStream* stream) -> bool override;
+    };
 
     using ConversationAssetContainer =
         AZStd::vector<AZ::Data::Asset<ConversationAsset>>;
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "AzCore/Outcome/Outcome.h"
+#include "AzCore/base.h"
+#include "AzCore/std/containers/span.h"
+#include "AzCore/std/string/string.h"
+
+namespace AZ::IO
+{
+    class GenericStream;
+}
+
+namespace Conversation
+{
+    class ConversationAsset;
+
+    /**
+     * The binary layout of a .conversationasset product.
+     *
+     * A product is a FileHeader followed by sections that the header locates
+     * by byte offset. Every section is a flat array of trivially copyable
+     * records, so a product can be loaded with a single read followed by one
+     * fix-up pass that turns the records into runtime objects. Strings are
+     * stored once in the string table and referenced by StringRef.
+     *
+     * Chunk text, which is most of a conversation's size, is kept in its own
+     * block. It is either embedded at the end of the product or written to a
+     * separate text product that is streamed in on demand; see
+     * ChunkTextStore.
+     *
+     * All values are little-endian, which holds for every platform the gem
+     * builds on. Sections are 4-byte aligned.
+     */
+    namespace AssetFormat
+    {
+        //! "CNVA" read as a little-endian 32-bit value.
+        constexpr AZ::u32 Magic{ 0x41564E43 };
+        //! Bump whenever any record below changes layout.
+        constexpr AZ::u32 Version{ 8 };
+
+        //! Set when chunk text lives in a separate text product.
+        constexpr AZ::u32 ExternalChunkTextFlag{ 1 << 0 };
+
+        //! A string stored in the string table.
+        struct StringRef
+        {
+            AZ::u32 m_offset;
+            AZ::u32 m_size;
+        };
+
+        //! A range of records inside one of the sections.
+        struct SectionRef
+        {
+            AZ::u32 m_offset;
+            AZ::u32 m_count;
+        };
+
+        struct AssetIdRecord
+        {
+            AZ::u8 m_guid[16];
+            AZ::u32 m_subId;
+        };
+
+        struct ResponseRecord
+        {
+            AZ::u32 m_parentDialogueId;
+            AZ::u32 m_responseDialogueId;
+        };
+
+        struct DialogueRecord
+        {
+            AZ::u32 m_id;
+            AZ::u32 m_availabilityId;
+            //! The name m_availabilityId was made from, so it never has to
+            //! be looked up at runtime.
+            StringRef m_availabilityKey;
+            StringRef m_shortText;
+            StringRef m_speaker;
+            StringRef m_comment;
+            //! Refers to the chunk text block rather than the string table.
+            StringRef m_chunk;
+            StringRef m_audioControl;
+            StringRef m_cinematicId;
+            //! The dialogue's response IDs in the response ID section.
+            SectionRef m_responseIds;
+            //! The dialogue's DialogueCondition in the condition section.
+            SectionRef m_condition;
+            float m_entryDelay;
+            float m_exitDelay;
+            //! Indices into the companion script's function table.
+            AZ::u32 m_scriptIndex;
+            AZ::u32 m_availabilityScriptIndex;
+        };
+
+        struct FileHeader
+        {
+            AZ::u32 m_magic;
+            AZ::u32 m_version;
+            AZ::u32 m_flags;
+            //! Size in bytes of the whole product, header included.
+            AZ::u32 m_fileSize;
+            //! Byte range of the string table.
+            SectionRef m_stringTable;
+            //! DialogueRecord array.
+            SectionRef m_dialogues;
+            //! UniqueId hashes referenced by DialogueRecord::m_responseIds.
+            SectionRef m_responseIds;
+            //! UniqueId hashes of the starting dialogues.
+            SectionRef m_startingIds;
+            //! ResponseRecord array.
+            SectionRef m_responses;
+            //! StringRef array of chunk text.
+            SectionRef m_chunks;
+            //! StringRef array of node symbol names.
+            SectionRef m_names;
+            //! Per-dialogue offsets into the response index section, plus
+            //! one past the end. See ConversationAsset::RebuildResponseGraph.
+            SectionRef m_responseOffsets;
+            //! DialogueIndex of every dialogue's responses, back to back.
+            SectionRef m_responseIndices;
+            //! Byte range of the embedded chunk text block. Empty when the
+            //! text is external.
+            SectionRef m_chunkText;
+            //! Per-bucket seeds of the dialogue ID perfect hash. See
+            //! DialogueLookupTable.
+            SectionRef m_dialogueLookupSeeds;
+            //! DialogueLookupTable::Slot array, one per dialogue.
+            SectionRef m_dialogueLookupSlots;
+            //! ConditionInstruction array referenced by
+            //! DialogueRecord::m_condition.
+            SectionRef m_conditionCode;
+            StringRef m_comment;
+            AssetIdRecord m_mainScript;
+        };
+
+        //! Returns true if the buffer starts with a binary product header.
+        [[nodiscard]] auto IsBinaryProduct(AZStd::span<AZ::u8 const> buffer)
+            -> bool;
+
+        /**
+         * @brief Writes the asset to the stream in the binary layout.
+         *
+         * @param chunkTextStream If given, chunk text is written there as a
+         * separate text product instead of being embedded.
+         */
+        [[nodiscard]] auto WriteConversationAsset(
+            ConversationAsset const& asset,
+            AZ::IO::GenericStream& stream,
+            AZ::IO::GenericStream* chunkTextStream = nullptr)
+            -> AZ::Outcome<void, AZStd::string>;
+
+        /**
+         * @brief Fills an empty asset from a binary product.
+         *
+         * Every offset and size in the product is validated before use, so a
+         * truncated or corrupt product fails cleanly instead of reading out
+         * of bounds. If the chunk text is external, the asset only records
+         * where each chunk is; see ConversationAsset::SetChunkTextSource.
+         */
+        [[nodiscard]] auto ReadConversationAsset(
+            AZStd::span<AZ::u8 const> buffer, ConversationAsset& asset)
+            -> AZ::Outcome<void, AZStd::string>;
+
+        /**
+         * @brief Convenience wrapper that writes the asset to a file.
+         *
+         * @param chunkTextFilePath If not empty, chunk text is written to
+         * this file instead of being embedded.
+         */
+        [[nodiscard]] auto SaveConversationAssetToFile(
+            ConversationAsset const& asset,
+            AZStd::string_view filePath,
+            AZStd::string_view chunkTextFilePath = {})
+            -> AZ::Outcome<void, AZStd::string>;
+
+        /**
+         * @brief Reads a product file into an empty asset.
+         *
+         * Products written before the binary layout existed are JSON; those
+         * are still accepted and loaded through the SerializeContext.
+         */
+        [[nodiscard]] auto LoadConversationAssetFromFile(
+            AZStd::string_view filePath, ConversationAsset& asset)
+            -> AZ::Outcome<void, AZStd::string>;
+    } // namespace AssetFormat
+} // namespace Conversation
@@ -4,6 +4,9 @@
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/Time/ITime.h>
 #include <Conversation/DialogueData.h>
 
 namespace Conversation
@@ -11,6 +14,24 @@ namespace Conversation
     constexpr static char const* const SPEAKERTAG_PLAYER = "player";
     constexpr static char const* const SPEAKERTAG_OWNER = "owner";
 
+    //! The starting dialogue an entity would open a conversation with.
+    struct AvailableStartingDialogue
+    {
+        AZ::EntityId m_entityId;
+        UniqueId m_dialogueId;
+    };
+
+    //! A conversation in progress, as the conversation system knows it.
+    struct ActiveConversation
+    {
+        //! The entity whose dialogue component runs the conversation.
+        AZ::EntityId m_target;
+        AZ::EntityId m_initiator;
+        bool m_involvesPlayer{};
+        //! The elapsed time the conversation started at.
+        AZ::TimeMs m_startTime{};
+    };
+
     class ConversationRequests
     {
     public:
@@ -21,7 +42,89 @@ namespace Conversation
 
         ConversationRequests() = default;
         virtual ~ConversationRequests() = default;
-        // Put your public methods here
+
+        /**
+         * @brief Tells the conversation system that the game state changed.
+         *
+         * Dialogue components that opt into caching keep availability
+         * answers until the epoch moves, so they need this called whenever
+         * something an availability check depends on changes.
+         */
+        virtual void BumpWorldStateEpoch() = 0;
+        [[nodiscard]] virtual auto GetWorldStateEpoch() const -> AZ::u64 = 0;
+
+        /**
+         * @brief Sets a fact that native dialogue conditions can read.
+         *
+         * Changing a fact bumps the world state epoch.
+         */
+        virtual void SetFact(AZStd::string_view name, AZ::s64 value) = 0;
+        //! Returns a fact's value, or 0 if it was never set.
+        [[nodiscard]] virtual auto GetFact(AZStd::string_view name) const
+            -> AZ::s64 = 0;
+
+        /**
+         * @brief Sets the entity the player controls.
+         *
+         * Conversations it starts are player conversations, and speakers are
+         * preloaded around it. Until a player is set, the entity tagged
+         * "player" is looked for instead, which is slower.
+         */
+        virtual void SetPlayerEntity(AZ::EntityId player) = 0;
+        //! Returns the player set by SetPlayerEntity, or an invalid ID.
+        [[nodiscard]] virtual auto GetPlayerEntity() const -> AZ::EntityId = 0;
+
+        /**
+         * @brief Sets how close speakers must be for their conversations to
+         *        be preloaded.
+         *
+         * Speakers within the interest radius of the focus entity are
+         * preloaded, and released once they are beyond the release radius.
+         */
+        virtual void SetPreloadRadii(
+            float interestRadius, float releaseRadius) = 0;
+        //! Preloads around the given entity instead of the player.
+        virtual void SetPreloadFocus(AZ::EntityId focus) = 0;
+
+        /**
+         * @brief Records that a conversation has started.
+         *
+         * Called by dialogue components. The start time is filled in here.
+         */
+        virtual void AddActiveConversation(
+            ActiveConversation const& conversation) = 0;
+        //! Called by dialogue components once their conversation is over.
+        virtual void RemoveActiveConversation(AZ::EntityId target) = 0;
+
+        //! True if the entity is the target or initiator of a conversation.
+        [[nodiscard]] virtual auto IsInConversation(
+            AZ::EntityId entityId) const -> bool = 0;
+        //! True if the entity is the target of a conversation with the player.
+        [[nodiscard]] virtual auto IsInPlayerConversation(
+            AZ::EntityId target) const -> bool = 0;
+        //! Returns nullptr if the target isn't in a conversation.
+        [[nodiscard]] virtual auto FindActiveConversation(
+            AZ::EntityId target) const -> ActiveConversation const* = 0;
+        [[nodiscard]] virtual auto CountActiveConversations() const
+            -> size_t = 0;
+
+        /**
+         * @brief Finds which entities have something to say.
+         *
+         * Each entity is checked the way TryToStartConversation would check
+         * it, but no conversation is started. Native conditions are evaluated
+         * across job worker threads; starting dialogues that need
+         * availability handlers are checked afterwards, on the calling thread.
+         *
+         * @returns The starting dialogue of each entity that could start a
+         * conversation, in the order the entities were given. Entities with
+         * nothing to say are left out.
+         *
+         * @note Must be called from the main thread.
+         */
+        [[nodiscard]] virtual auto FindAvailableStartingDialogues(
+            AZStd::span<AZ::EntityId const> entityIds)
+            -> AZStd::vector<AvailableStartingDialogue> = 0;
     };
 
     class ConversationBusTraits : public AZ::EBusTraits
@@ -3,15 +3,22 @@
 namespace Conversation
 {
     // clang-format off
+    constexpr auto ConditionInstructionTypeId          { "{E4A7C2D9-1F83-4B6E-95A0-3C8D7B2E6F14}" };
     constexpr auto ConversationAssetRefComponentTypeId { "{2A4DACCE-2AEA-4007-93C5-8F5EF1110DA8}" };
     constexpr auto ConversationAssetInterfaceTypeId    { "{E055BA9A-31A0-48B5-B5B8-CD758771B151}" };
+    constexpr auto ConversationChunkTextTypeId         { "{B7E2A9D4-5C13-4F6E-8A01-3D9F6C2E71B5}" };
     constexpr auto ConversationAssetTypeId             { "{C2B4E407-B74E-4E48-8B8A-ADD5BCC894D1}" };
     constexpr auto ConversationSystemComponentTypeId   { "{30f94275-e830-466f-b1c6-140156911232}" };
     constexpr auto ConversationVMTypeId                { "{8D316C6D-7EDC-4C11-A885-0C10CF41BA52}" };
+    constexpr auto DialogueChunkRefTypeId              { "{9F4B2C71-3A6E-4D58-B1C9-0E7A5D2F8346}" };
     constexpr auto DialogueComponentConfigTypeId       { "{88CFED66-271F-4CC7-A573-E7E0C9456ECD}" };
+    constexpr auto DialogueConditionTypeId             { "{7C3F9A2E-D614-4E8B-A5C7-09B1E4D2F863}" };
     constexpr auto DialogueComponentTypeId             { "{C7AFDF51-ECCC-4BD3-8A56-0763ED87CB5B}" };
     constexpr auto DialogueDataTypeId                  { "{6BF81F0F-0013-4877-80EB-4DC579005DDE}" };
+    constexpr auto DialogueHandleTypeId                { "{5A1D3F6E-2C47-4B8E-9E0B-7C2F4D1A8B63}" };
+    constexpr auto DialoguePayloadTypeId               { "{0B6E4D29-8A73-4C1F-B5E2-6D9A3F17C842}" };
     constexpr auto DialogueIdTypeId                    { "{68AE77C6-9865-47DE-8BFE-D6D67663C5DC}" };
+    constexpr auto PooledStringTypeId                  { "{3E9C51B2-7D84-4F0A-A6C3-91B5E2D047F8}" };
     constexpr auto ResponseDataTypeId                  { "{AEC51FC7-A91F-40D6-8EBA-59D0EADBAA4C}" };
     constexpr auto TagComponentTypeId                  { "{0F16A377-EAA0-47D2-8472-9EAAA680B169}" };
     constexpr auto VMValueTypeId                       { "{ED542FA7-A789-4E54-95D7-E2330FFD6768}" };
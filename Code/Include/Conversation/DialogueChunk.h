@@ -24,14 +24,20 @@ namespace Conversation
 
         friend void ReflectDialogueChunk(AZ::ReflectContext* reflect);
 
+        DialogueChunk()
+        {
+            UpdateHash();
+        }
+
         [[nodiscard]] auto operator==(DialogueChunk const& rhs) const -> bool
         {
-            return GetHash() == rhs.GetHash();
+            return m_hash == rhs.m_hash && m_data == rhs.m_data;
         }
 
         void SetData(AZStd::string_view data)
         {
             m_data = data;
+            UpdateHash();
         }
 
         [[nodiscard]] auto GetData() const -> AZStd::string_view
@@ -39,14 +45,27 @@ namespace Conversation
             return m_data;
         }
 
+        //! Returns the hash of the chunk's data, computed when it was set.
         [[nodiscard]] auto GetHash() const -> size_t
+        {
+            return m_hash;
+        }
+
+        /**
+         * @brief Recomputes the cached hash.
+         *
+         * Only needed when m_data is written to directly, as serialization
+         * and the editor do.
+         */
+        void UpdateHash()
         {
             constexpr AZStd::hash<AZStd::string> hasher;
-            return hasher(m_data);
+            m_hash = hasher(m_data);
         }
 
     private:
         AZStd::string m_data;
+        size_t m_hash{};
     };
 
 } // namespace Conversation
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "AzCore/RTTI/TypeInfoSimple.h"
+
+#include "Conversation/ConversationTypeIds.h"
+#include "Conversation/DialogueChunk.h"
+#include "Conversation/InternTable.h"
+
+namespace AZ
+{
+    class ReflectContext;
+}
+
+namespace Conversation
+{
+    //! Identifies a chunk held by the DialogueChunkStore.
+    using DialogueChunkId = InternId;
+    //! The ID of the empty chunk. It is always valid.
+    constexpr DialogueChunkId EmptyDialogueChunkId{ EmptyInternId };
+
+    //! How the DialogueChunkStore stores and compares its chunks.
+    struct DialogueChunkTraits
+    {
+        using Value = DialogueChunk;
+        using Key = DialogueChunk;
+
+        //! Chunks cache their hash, so it isn't computed again.
+        [[nodiscard]] static auto Hash(Key const& chunk) -> size_t
+        {
+            return chunk.GetHash();
+        }
+
+        [[nodiscard]] static auto IsEmpty(Key const& chunk) -> bool
+        {
+            return chunk.GetData().empty();
+        }
+
+        [[nodiscard]] static auto Equals(
+            Value const& value, Key const& chunk) -> bool
+        {
+            return value == chunk;
+        }
+    };
+
+    /**
+     * @brief A process-wide, content-addressed store of dialogue chunks.
+     *
+     * Chunks are looked up by their cached hash, so lines that repeat across
+     * assets ("Goodbye.", "I see.") are stored once no matter how many assets
+     * are loaded.
+     *
+     * Like the StringPool, chunks are reference counted and removed once
+     * nothing refers to them. A chunk stays valid for as long as a
+     * DialogueChunkRef to it exists.
+     */
+    class DialogueChunkStore : public InternTable<DialogueChunkTraits>
+    {
+    public:
+        //! Returns the store shared by every module in the process.
+        static auto Get() -> DialogueChunkStore&;
+    };
+
+    /**
+     * @brief A dialogue's reference to a chunk in the DialogueChunkStore.
+     *
+     * Copying one only touches a reference count, and comparing two is a
+     * single ID comparison. It serializes as the chunk's text.
+     */
+    class DialogueChunkRef
+    {
+    public:
+        AZ_TYPE_INFO(DialogueChunkRef, DialogueChunkRefTypeId); // NOLINT
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        DialogueChunkRef() = default;
+        explicit DialogueChunkRef(DialogueChunk const& chunk)
+            : m_id(DialogueChunkStore::Get().Acquire(chunk))
+        {
+        }
+
+        DialogueChunkRef(DialogueChunkRef const& other)
+            : m_id(other.m_id)
+        {
+            Retain();
+        }
+
+        DialogueChunkRef(DialogueChunkRef&& other) noexcept
+            : m_id(other.m_id)
+        {
+            other.m_id = EmptyDialogueChunkId;
+        }
+
+        ~DialogueChunkRef()
+        {
+            Release();
+        }
+
+        auto operator=(DialogueChunkRef const& other) -> DialogueChunkRef&
+        {
+            if (m_id != other.m_id)
+            {
+                Release();
+                m_id = other.m_id;
+                Retain();
+            }
+            return *this;
+        }
+
+        auto operator=(DialogueChunkRef&& other) noexcept -> DialogueChunkRef&
+        {
+            if (this != &other)
+            {
+                Release();
+                m_id = other.m_id;
+                other.m_id = EmptyDialogueChunkId;
+            }
+            return *this;
+        }
+
+        [[nodiscard]] auto GetId() const -> DialogueChunkId
+        {
+            return m_id;
+        }
+
+        [[nodiscard]] auto IsEmpty() const -> bool
+        {
+            return m_id == EmptyDialogueChunkId;
+        }
+
+        [[nodiscard]] auto GetChunk() const -> DialogueChunk const&
+        {
+            return DialogueChunkStore::Get().Resolve(m_id);
+        }
+
+        [[nodiscard]] auto GetText() const -> AZStd::string_view
+        {
+            return IsEmpty() ? AZStd::string_view{} : GetChunk().GetData();
+        }
+
+        [[nodiscard]] auto operator==(DialogueChunkRef const& other) const
+            -> bool
+        {
+            return m_id == other.m_id;
+        }
+
+        [[nodiscard]] auto operator!=(DialogueChunkRef const& other) const
+            -> bool
+        {
+            return m_id != other.m_id;
+        }
+
+    private:
+        void Retain() const
+        {
+            if (!IsEmpty())
+            {
+                DialogueChunkStore::Get().Retain(m_id);
+            }
+        }
+
+        void Release() const
+        {
+            if (!IsEmpty())
+            {
+                DialogueChunkStore::Get().Release(m_id);
+            }
+        }
+
+        DialogueChunkId m_id{ EmptyDialogueChunkId };
+    };
+} // namespace Conversation
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "AzCore/Component/ComponentBus.h"
+#include "AzCore/std/containers/vector.h"
+#include "Conversation/DialogueHandle.h"
+#include "Conversation/DialoguePayload.h"
 #include "Conversation/IConversationAsset.h"
 
 namespace Conversation
@@ -131,6 +134,18 @@ namespace Conversation
         [[nodiscard]] virtual auto GetActiveDialogue() const
             -> AZ::Outcome<DialogueData> = 0;
         [[nodiscard]] virtual auto GetCurrentState() const -> DialogueState = 0;
+
+        /**
+         * @brief Adds the dialogues a conversation could start with, in the
+         *        order they would be tried.
+         *
+         * Nothing is added unless a conversation could be started right now.
+         * The views stay valid until the component deactivates.
+         *
+         * @see ConversationRequests::FindAvailableStartingDialogues
+         */
+        virtual void AppendStartingDialogues(
+            AZStd::vector<DialogueView>& dialogues) const = 0;
     };
 
     using DialogueComponentRequestBus = AZ::EBus<DialogueComponentRequests>;
@@ -178,9 +193,26 @@ namespace Conversation
         [[nodiscard]] virtual auto GetDialogueComponentNotificationOrder()
             -> int = 0;
 
+        /**
+         * Sent out when a dialogue is spoken, before OnDialogue.
+         *
+         * Nothing is copied to send it, which makes it much cheaper than
+         * OnDialogue for script listeners.
+         *
+         * @param payload The spoken dialogue and its available responses. It
+         * is only valid during this call.
+         */
+        virtual void OnDialogueSpoken(
+            [[maybe_unused]] DialoguePayload const& payload)
+        {
+        }
+
         /**
          * Sent out when a dialogue is selected/spoken.
          *
+         * @deprecated Use OnDialogueSpoken. This copies every response, so it
+         * is only sent when a handler on the entity wants it.
+         *
          * @param dialogue The dialogue that was sent out and is now active.
          * @param potentialResponses (Pending removal) A list of responses that
          * may be sent out.
@@ -191,6 +223,18 @@ namespace Conversation
                 potentialResponses)
         {
         }
+
+        /**
+         * Returns whether the handler wants OnDialogue.
+         *
+         * Script handlers only want it if they implement it.
+         *
+         * @note The function can't be const due to behavior handlers.
+         */
+        [[nodiscard]] virtual auto WantsOnDialogue() -> bool
+        {
+            return true;
+        }
         virtual void OnConversationStarted(
             [[maybe_unused]] const AZ::EntityId initiatingEntityId)
         {
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "AzCore/Interface/Interface.h"
+#include "AzCore/RTTI/TypeInfoSimple.h"
+#include "AzCore/std/containers/span.h"
+#include "AzCore/std/containers/vector.h"
+
+#include "Conversation/ConversationTypeIds.h"
+
+namespace AZ
+{
+    class ReflectContext;
+}
+
+namespace Conversation
+{
+    //! The value type every condition instruction works on.
+    using ConditionValue = AZ::s64;
+
+    enum class ConditionOp : AZ::u32
+    {
+        //! Pushes the operand, sign extended.
+        PushInt,
+        //! Pushes the operand, zero extended. Also used for bools and CRCs.
+        PushUint,
+        //! Pushes the fact whose ID is the operand. Missing facts are 0.
+        PushFact,
+        //! Pops two values and pushes 1 if they are equal, else 0.
+        Equal,
+        NotEqual,
+        //! Pops two values and pushes 1 if both are non-zero, else 0.
+        And,
+        Or,
+        //! Pops a value and pushes 1 if it is zero, else 0.
+        Not,
+        Count
+    };
+
+    struct ConditionInstruction
+    {
+        AZ_TYPE_INFO( // NOLINT
+            ConditionInstruction,
+            ConditionInstructionTypeId);
+
+        ConditionOp m_op{};
+        AZ::u32 m_operand{};
+    };
+
+    /**
+     * @brief Answers the fact lookups of a DialogueCondition.
+     *
+     * Facts are named game state values, such as quest flags, identified by
+     * the CRC32 of their name.
+     */
+    class ConditionFacts
+    {
+    public:
+        AZ_RTTI( // NOLINT
+            ConditionFacts,
+            "{5D0C2E91-7B3A-4F64-9E18-A6C04B2D7F35}");
+        AZ_DISABLE_COPY_MOVE(ConditionFacts); // NOLINT
+
+        ConditionFacts() = default;
+        virtual ~ConditionFacts() = default;
+
+        [[nodiscard]] virtual auto GetFact(AZ::u32 factId) const
+            -> ConditionValue = 0;
+    };
+
+    using ConditionFactsInterface = AZ::Interface<ConditionFacts>;
+
+    /**
+     * @brief A pure-expression availability condition, run without script.
+     *
+     * Conditions that only compare facts and constants are compiled to a
+     * short stack program and evaluated here, so checking them costs a few
+     * nanoseconds instead of a trip into Lua. Conditions that call script
+     * code keep using the AvailabilityRequestBus.
+     *
+     * A program is validated when it is assigned, so evaluation never has to
+     * check for stack underflow or overflow.
+     */
+    class DialogueCondition
+    {
+    public:
+        AZ_TYPE_INFO(DialogueCondition, DialogueConditionTypeId); // NOLINT
+
+        //! The deepest stack a program may use.
+        static constexpr size_t MaxStackDepth{ 16 };
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! Returns true if the program is well formed and leaves one value.
+        [[nodiscard]] static auto Validate(
+            AZStd::span<ConditionInstruction const> code) -> bool;
+
+        /**
+         * @brief Replaces the program.
+         *
+         * @returns False, leaving the condition empty, if the program doesn't
+         * validate.
+         */
+        auto SetCode(AZStd::vector<ConditionInstruction> code) -> bool;
+
+        void Clear()
+        {
+            m_code.clear();
+        }
+
+        [[nodiscard]] auto GetCode() const
+            -> AZStd::span<ConditionInstruction const>
+        {
+            return m_code;
+        }
+
+        [[nodiscard]] auto IsEmpty() const -> bool
+        {
+            return m_code.empty();
+        }
+
+        /**
+         * @brief Runs the program.
+         *
+         * @param facts Where facts are read from. If null, every fact is 0.
+         * @returns True if the program leaves a non-zero value. An empty
+         * condition is always true.
+         */
+        [[nodiscard]] auto Evaluate(ConditionFacts const* facts) const -> bool;
+
+    private:
+        AZStd::vector<ConditionInstruction> m_code;
+    };
+} // namespace Conversation
+
+namespace AZ
+{
+    AZ_TYPE_INFO_SPECIALIZE( // NOLINT
+        Conversation::ConditionOp,
+        "{B1E86A3F-4C27-4D95-8F0A-72D3C5E9164B}");
+} // namespace AZ
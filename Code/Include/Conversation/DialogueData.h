@@ -3,11 +3,15 @@
 #include "AzCore/Memory/SystemAllocator.h"
 #include "AzCore/Name/Name.h"
 #include "AzCore/std/containers/unordered_set.h"
+#include "AzCore/std/limits.h"
 #include "AzCore/std/string/string.h"
 
 #include "Conversation/ConversationTypeIds.h"
 #include "Conversation/DialogueChunk.h"
+#include "Conversation/DialogueChunkStore.h"
+#include "Conversation/DialogueCondition.h"
 #include "Conversation/ResponseData.h"
+#include "Conversation/StringPool.h"
 #include "Conversation/UniqueId.h"
 #include "DialogueAudioControl.h"
 
@@ -42,6 +46,10 @@ namespace Conversation
         static constexpr auto MaxResponses{ 10 };
         static constexpr auto DefaultEntryDelay{ 0 };
         static constexpr auto DefaultExitDelay{ 0 };
+        //! The dialogue has no function in the companion script's table.
+        static constexpr AZ::u32 NoScriptIndex{
+            AZStd::numeric_limits<AZ::u32>::max()
+        };
 
         AZ_DEFAULT_COPY_MOVE(DialogueData); // NOLINT
 
@@ -143,9 +151,24 @@ namespace Conversation
             return m_availabilityId;
         }
 
-        [[nodiscard]] constexpr auto GetComment() const -> AZStd::string_view
+        /**
+         * @brief Returns the dialogue's native availability condition.
+         *
+         * When it isn't empty, it replaces the AvailabilityRequestBus check.
+         */
+        [[nodiscard]] auto GetCondition() const -> DialogueCondition const&
         {
-            return m_comment;
+            return m_condition;
+        }
+
+        void SetCondition(DialogueCondition condition)
+        {
+            m_condition = AZStd::move(condition);
+        }
+
+        [[nodiscard]] auto GetComment() const -> AZStd::string_view
+        {
+            return m_comment.GetStringView();
         }
 
         constexpr void SetAvailabilityId(AvailabilityId newAvailabilityId)
@@ -158,24 +181,24 @@ namespace Conversation
             m_availabilityId = UniqueId::CreateNamedId(newAvailabilityId);
         }
 
-        [[nodiscard]] constexpr auto GetShortText() const -> AZStd::string_view
+        [[nodiscard]] auto GetShortText() const -> AZStd::string_view
         {
-            return m_shortText;
+            return m_shortText.GetStringView();
         }
 
         void SetShortText(AZStd::string_view actorText)
         {
-            m_shortText = actorText;
+            m_shortText = PooledString{ actorText };
         }
 
-        [[nodiscard]] constexpr auto GetSpeaker() const -> AZStd::string_view
+        [[nodiscard]] auto GetSpeaker() const -> AZStd::string_view
         {
-            return m_speaker;
+            return m_speaker.GetStringView();
         }
 
         void SetSpeaker(AZStd::string_view speaker)
         {
-            m_speaker = speaker;
+            m_speaker = PooledString{ speaker };
         }
 
         void SetAudioControl(DialogueAudioControl const& audioTrigger)
@@ -183,19 +206,70 @@ namespace Conversation
             m_audioControl = audioTrigger;
         }
 
+        //! Seconds to wait, once the dialogue is selected, before it's spoken.
+        [[nodiscard]] constexpr auto GetEntryDelay() const -> float
+        {
+            return m_entryDelay;
+        }
+
         constexpr void SetEntryDelay(float entryDelay)
         {
             m_entryDelay = entryDelay;
         }
 
+        /**
+         * @brief Seconds to wait, once the dialogue is spoken, before the
+         *        conversation continues on its own.
+         *
+         * Zero leaves continuing to ContinueConversation's callers.
+         */
+        [[nodiscard]] constexpr auto GetExitDelay() const -> float
+        {
+            return m_exitDelay;
+        }
+
+        constexpr void SetExitDelay(float exitDelay)
+        {
+            m_exitDelay = exitDelay;
+        }
+
+        /**
+         * @brief Where the dialogue's script is in the companion script's
+         *        function table.
+         *
+         * The table and the index are generated together, so scripts can be
+         * run without looking them up by name.
+         */
+        [[nodiscard]] constexpr auto GetScriptIndex() const -> AZ::u32
+        {
+            return m_scriptIndex;
+        }
+
+        constexpr void SetScriptIndex(AZ::u32 scriptIndex)
+        {
+            m_scriptIndex = scriptIndex;
+        }
+
+        //! Where the availability check is in the companion script's table.
+        [[nodiscard]] constexpr auto GetAvailabilityScriptIndex() const
+            -> AZ::u32
+        {
+            return m_availabilityScriptIndex;
+        }
+
+        constexpr void SetAvailabilityScriptIndex(AZ::u32 scriptIndex)
+        {
+            m_availabilityScriptIndex = scriptIndex;
+        }
+
         void SetComment(AZStd::string& comment)
         {
-            m_comment = comment;
+            m_comment = PooledString{ comment };
         }
 
         void SetComment(AZStd::string_view comment)
         {
-            m_comment = comment;
+            m_comment = PooledString{ comment };
         }
 
         [[nodiscard]] auto CountResponseIds() const -> size_t
@@ -264,55 +338,78 @@ namespace Conversation
 
         void SetChunk(DialogueChunk const& chunk)
         {
-            // FIXME: While still developing, setting a chunk when the short
-            // text is empty will also assign the chunk's value to the short
-            // text. This will change once chunks are fully implemented.
-            if (m_shortText.empty())
+            // Setting a chunk when the short text is empty also assigns the
+            // chunk's value to the short text. Streamed assets rely on this,
+            // since short text taken from a chunk isn't saved with them.
+            if (m_shortText.IsEmpty())
             {
-                m_shortText = chunk.GetData();
+                m_shortText = PooledString{ chunk.GetData() };
             }
 
-            m_dialogueChunk = chunk;
+            m_dialogueChunk = DialogueChunkRef{ chunk };
         }
 
-        [[nodiscard]] auto GetChunkAsText() -> AZStd::string_view
+        [[nodiscard]] auto GetChunkAsText() const -> AZStd::string_view
         {
-            return m_dialogueChunk.GetData();
+            return m_dialogueChunk.GetText();
         }
 
         [[nodiscard]] auto GetChunk() const -> DialogueChunk
+        {
+            return m_dialogueChunk.GetChunk();
+        }
+
+        //! Returns the dialogue's reference into the DialogueChunkStore.
+        [[nodiscard]] auto GetChunkRef() const -> DialogueChunkRef const&
         {
             return m_dialogueChunk;
         }
 
         void SetCinematicId(AZ::Name const& cinematicId)
         {
-            m_cinematicId = cinematicId;
+            m_cinematicId = PooledString{ cinematicId.GetStringView() };
         }
 
         [[nodiscard]] auto GetCinematicId() const -> AZ::Name
         {
-            return m_cinematicId;
+            return m_cinematicId.IsEmpty()
+                ? AZ::Name{}
+                : AZ::Name{ m_cinematicId.GetStringView() };
+        }
+
+        [[nodiscard]] auto HasCinematic() const -> bool
+        {
+            return !m_cinematicId.IsEmpty();
         }
 
     private:
-        DialogueChunk m_dialogueChunk{};
+        // Chunks are shared through the DialogueChunkStore, since the same
+        // lines are often spoken in many places.
+        DialogueChunkRef m_dialogueChunk{};
         AZStd::vector<UniqueId> m_responseIds{};
-        AZStd::string m_shortText{};
-        AZStd::string m_speaker{};
+        // Text is pooled since the same strings, speaker tags especially,
+        // repeat across many dialogues.
+        PooledString m_shortText{};
+        PooledString m_speaker{};
         // The audio trigger to execute upon selection of this dialogue.
         DialogueAudioControl m_audioControl{};
-        AZ::Name m_cinematicId{};
+        // Most dialogues have no cinematic, so this is pooled rather than an
+        // AZ::Name to keep the empty case to a single ID.
+        PooledString m_cinematicId{};
         // Any comments from the writers of this dialogue.
-        AZStd::string m_comment{};
+        PooledString m_comment{};
         UniqueId m_availabilityId{};
+        // Conditions simple enough to run without script.
+        DialogueCondition m_condition{};
         UniqueId m_id{ UniqueId::CreateInvalidId() };
         float m_entryDelay{ DefaultEntryDelay };
         float m_exitDelay{ DefaultExitDelay };
+        AZ::u32 m_scriptIndex{ NoScriptIndex };
+        AZ::u32 m_availabilityScriptIndex{ NoScriptIndex };
     };
 
     using DialogueDataPtr = AZStd::shared_ptr<DialogueData>;
-    using DialogueDataContainer = AZStd::unordered_set<DialogueData>;
+    using DialogueDataContainer = AZStd::vector<DialogueData>;
 
     /**
      * @brief Creates a string containing lua code that creates a matching
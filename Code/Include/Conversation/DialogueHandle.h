@@ -0,0 +1,207 @@
+#pragma once
+
+#include "AzCore/std/containers/span.h"
+#include "AzCore/std/limits.h"
+
+#include "Conversation/ConversationTypeIds.h"
+#include "Conversation/DialogueData.h"
+
+namespace AZ
+{
+    class ReflectContext;
+}
+
+namespace Conversation
+{
+    class ConversationAsset;
+
+    //! The position of a DialogueData within an asset's dialogue table.
+    using DialogueIndex = AZ::u32;
+    constexpr DialogueIndex InvalidDialogueIndex{
+        AZStd::numeric_limits<DialogueIndex>::max()
+    };
+
+    /**
+     * @brief A read-only view of a DialogueData owned by someone else.
+     *
+     * Views never copy the dialogue. They are only valid for as long as the
+     * dialogue they were created from stays alive and unmoved.
+     */
+    class DialogueView
+    {
+    public:
+        DialogueView() = default;
+        explicit DialogueView(DialogueData const* dialogue)
+            : m_dialogue(dialogue)
+        {
+        }
+
+        [[nodiscard]] auto IsValid() const -> bool
+        {
+            return m_dialogue != nullptr && m_dialogue->IsValid();
+        }
+
+        [[nodiscard]] auto GetId() const -> UniqueId
+        {
+            return m_dialogue ? m_dialogue->GetId() : UniqueId{};
+        }
+
+        [[nodiscard]] auto GetAvailabilityId() const -> UniqueId
+        {
+            return m_dialogue ? m_dialogue->GetAvailabilityId() : UniqueId{};
+        }
+
+        [[nodiscard]] auto GetShortText() const -> AZStd::string_view
+        {
+            return m_dialogue ? m_dialogue->GetShortText()
+                              : AZStd::string_view{};
+        }
+
+        [[nodiscard]] auto GetSpeaker() const -> AZStd::string_view
+        {
+            return m_dialogue ? m_dialogue->GetSpeaker() : AZStd::string_view{};
+        }
+
+        [[nodiscard]] auto GetChunkText() const -> AZStd::string_view
+        {
+            return m_dialogue ? m_dialogue->GetChunkAsText()
+                              : AZStd::string_view{};
+        }
+
+        [[nodiscard]] auto GetResponseIds() const
+            -> AZStd::span<UniqueId const>
+        {
+            return m_dialogue ? AZStd::span<UniqueId const>(
+                                    m_dialogue->GetResponseIds())
+                              : AZStd::span<UniqueId const>{};
+        }
+
+        /**
+         * @brief Returns the viewed dialogue.
+         *
+         * @warning The view must be valid.
+         */
+        [[nodiscard]] auto GetDialogue() const -> DialogueData const&
+        {
+            AZ_Assert(m_dialogue, "Dereferenced an empty DialogueView.");
+            return *m_dialogue;
+        }
+
+    private:
+        DialogueData const* m_dialogue{};
+    };
+
+    /**
+     * @brief Refers to a dialogue by its position in a ConversationAsset.
+     *
+     * A handle is two words and is cheap to copy and pass to scripts. It
+     * stays valid for as long as the asset it came from is loaded.
+     */
+    class DialogueHandle
+    {
+    public:
+        AZ_TYPE_INFO(DialogueHandle, DialogueHandleTypeId); // NOLINT
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        DialogueHandle() = default;
+        DialogueHandle(ConversationAsset const* asset, DialogueIndex index)
+            : m_asset(index != InvalidDialogueIndex ? asset : nullptr)
+            , m_index(asset != nullptr ? index : InvalidDialogueIndex)
+        {
+        }
+
+        [[nodiscard]] auto IsValid() const -> bool
+        {
+            return m_asset != nullptr;
+        }
+
+        [[nodiscard]] auto GetAsset() const -> ConversationAsset const*
+        {
+            return m_asset;
+        }
+
+        [[nodiscard]] auto GetIndex() const -> DialogueIndex
+        {
+            return m_index;
+        }
+
+        /**
+         * @brief Returns the dialogue this handle refers to.
+         *
+         * @returns A pointer into the asset's dialogue table, or nullptr if
+         * the handle is invalid.
+         */
+        [[nodiscard]] auto GetDialogue() const -> DialogueData const*;
+
+        [[nodiscard]] auto GetView() const -> DialogueView
+        {
+            return DialogueView{ GetDialogue() };
+        }
+
+        [[nodiscard]] auto GetId() const -> UniqueId
+        {
+            return GetView().GetId();
+        }
+
+        [[nodiscard]] auto GetShortText() const -> AZStd::string_view
+        {
+            return GetView().GetShortText();
+        }
+
+        [[nodiscard]] auto GetSpeaker() const -> AZStd::string_view
+        {
+            return GetView().GetSpeaker();
+        }
+
+        /**
+         * @brief Returns the dialogue's chunk text.
+         *
+         * Unlike the view, this sees text the asset streams in, as long as it
+         * is currently loaded.
+         */
+        [[nodiscard]] auto GetChunkText() const -> AZStd::string_view;
+
+        [[nodiscard]] auto CountResponseIds() const -> size_t
+        {
+            return GetView().GetResponseIds().size();
+        }
+
+        /**
+         * @returns The response ID at the given position, or an invalid ID if
+         * the position is out of range.
+         */
+        [[nodiscard]] auto GetResponseId(size_t responseIndex) const
+            -> UniqueId
+        {
+            auto const responseIds = GetView().GetResponseIds();
+            return responseIndex < responseIds.size()
+                ? responseIds[responseIndex]
+                : UniqueId{};
+        }
+
+        //! Returns a copy of the dialogue, or a default one if invalid.
+        [[nodiscard]] auto CopyDialogue() const -> DialogueData
+        {
+            auto const* const dialogue = GetDialogue();
+            return dialogue ? *dialogue : DialogueData{};
+        }
+
+        [[nodiscard]] auto operator==(DialogueHandle const& other) const
+            -> bool
+        {
+            return m_asset == other.m_asset && m_index == other.m_index;
+        }
+
+        [[nodiscard]] auto operator!=(DialogueHandle const& other) const
+            -> bool
+        {
+            return !(*this == other);
+        }
+
+    private:
+        ConversationAsset const* m_asset{};
+        DialogueIndex m_index{ InvalidDialogueIndex };
+    };
+
+} // namespace Conversation
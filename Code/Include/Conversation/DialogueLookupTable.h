@@ -0,0 +1,116 @@
+#pragma once
+
+#include "AzCore/base.h"
+#include "AzCore/std/containers/span.h"
+#include "AzCore/std/containers/vector.h"
+
+#include "Conversation/DialogueHandle.h"
+#include "Conversation/UniqueId.h"
+
+namespace Conversation
+{
+    /**
+     * @brief A minimal perfect hash from dialogue IDs to dialogue indices.
+     *
+     * It is built with CHD (compress, hash, displace). IDs are split into
+     * small buckets, and each bucket stores the seed that sends all of its IDs
+     * to free slots. There is exactly one slot per dialogue, so a lookup is two
+     * hashes, three reads and a compare, with no probing however many
+     * dialogues there are.
+     *
+     * An ID that isn't in the table still lands on some slot, so each slot
+     * keeps the ID it was built for and a mismatch means "not found".
+     */
+    class DialogueLookupTable
+    {
+    public:
+        struct Slot
+        {
+            AZ::u32 m_id;
+            DialogueIndex m_index;
+        };
+
+        /**
+         * @brief Builds the table so that ids[i] maps to index i.
+         *
+         * @returns False, leaving the table empty, if an ID repeats or no
+         * seed could be found for a bucket.
+         */
+        auto Build(AZStd::span<AZ::u32 const> ids) -> bool;
+
+        /**
+         * @brief Adopts a table that was built ahead of time.
+         *
+         * @returns False, leaving the table empty, unless the table maps
+         * ids[i] to index i for every ID.
+         */
+        auto Assign(
+            AZStd::vector<AZ::u32> seeds,
+            AZStd::vector<Slot> slots,
+            AZStd::span<AZ::u32 const> ids) -> bool;
+
+        void Clear();
+
+        [[nodiscard]] auto IsEmpty() const -> bool
+        {
+            return m_slots.empty();
+        }
+
+        /**
+         * @brief Returns the index of the dialogue with the given ID.
+         *
+         * @returns The index, or InvalidDialogueIndex if not found.
+         */
+        [[nodiscard]] auto Find(UniqueId const& dialogueId) const
+            -> DialogueIndex
+        {
+            if (m_slots.empty())
+            {
+                return InvalidDialogueIndex;
+            }
+
+            auto const id = dialogueId.GetHash();
+            auto const seed = m_seeds[Reduce(Hash(id, 0), m_seeds.size())];
+            auto const& slot = m_slots[Reduce(Hash(id, seed), m_slots.size())];
+            return slot.m_id == id ? slot.m_index : InvalidDialogueIndex;
+        }
+
+        [[nodiscard]] auto GetSeeds() const -> AZStd::span<AZ::u32 const>
+        {
+            return m_seeds;
+        }
+
+        [[nodiscard]] auto GetSlots() const -> AZStd::span<Slot const>
+        {
+            return m_slots;
+        }
+
+    private:
+        //! Mixes an ID with a seed; the murmur3 finalizer.
+        [[nodiscard]] static constexpr auto Hash(AZ::u32 id, AZ::u32 seed)
+            -> AZ::u32
+        {
+            constexpr AZ::u32 GoldenRatio{ 0x9E3779B9 };
+            AZ::u32 hash = id ^ (seed * GoldenRatio);
+            hash ^= hash >> 16;
+            hash *= 0x85EBCA6B;
+            hash ^= hash >> 13;
+            hash *= 0xC2B2AE35;
+            hash ^= hash >> 16;
+            return hash;
+        }
+
+        //! Maps a hash onto [0, range) without a division.
+        [[nodiscard]] static constexpr auto Reduce(AZ::u32 hash, size_t range)
+            -> size_t
+        {
+            return static_cast<size_t>(
+                (static_cast<AZ::u64>(hash) * range) >> 32);
+        }
+
+        //! The displacement seed of each bucket.
+        AZStd::vector<AZ::u32> m_seeds;
+        //! One slot per dialogue.
+        AZStd::vector<Slot> m_slots;
+    };
+} // namespace Conversation
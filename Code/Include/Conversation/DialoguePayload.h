@@ -0,0 +1,107 @@
+#pragma once
+
+#include "AzCore/std/containers/span.h"
+#include "AzCore/std/string/string_view.h"
+
+#include "Conversation/ConversationTypeIds.h"
+#include "Conversation/DialogueData.h"
+#include "Conversation/DialogueHandle.h"
+
+namespace AZ
+{
+    class ReflectContext;
+}
+
+namespace Conversation
+{
+    /**
+     * @brief What OnDialogueSpoken hands its listeners.
+     *
+     * The payload refers to the spoken dialogue and its responses instead of
+     * copying them. Text is only read when a listener asks for it, and
+     * scripts receive the payload as one object rather than a copy of every
+     * dialogue.
+     *
+     * @warning A payload is only valid during the notification it was sent
+     * with. Listeners that need a dialogue afterwards should copy it.
+     */
+    class DialoguePayload
+    {
+    public:
+        AZ_TYPE_INFO(DialoguePayload, DialoguePayloadTypeId); // NOLINT
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        DialoguePayload() = default;
+        DialoguePayload(
+            DialogueData const* dialogue,
+            AZStd::span<DialogueHandle const> responses)
+            : m_dialogue(dialogue)
+            , m_responses(responses)
+        {
+        }
+
+        [[nodiscard]] auto IsValid() const -> bool
+        {
+            return m_dialogue != nullptr;
+        }
+
+        [[nodiscard]] auto GetDialogueId() const -> UniqueId
+        {
+            return m_dialogue ? m_dialogue->GetId() : UniqueId{};
+        }
+
+        [[nodiscard]] auto GetShortText() const -> AZStd::string_view
+        {
+            return m_dialogue ? m_dialogue->GetShortText()
+                              : AZStd::string_view{};
+        }
+
+        [[nodiscard]] auto GetSpeaker() const -> AZStd::string_view
+        {
+            return m_dialogue ? m_dialogue->GetSpeaker() : AZStd::string_view{};
+        }
+
+        //! Streamed text has already been filled in by the time it's spoken.
+        [[nodiscard]] auto GetChunkText() const -> AZStd::string_view
+        {
+            return m_dialogue ? m_dialogue->GetChunkAsText()
+                              : AZStd::string_view{};
+        }
+
+        //! Returns a copy of the dialogue, or a default one if invalid.
+        [[nodiscard]] auto CopyDialogue() const -> DialogueData
+        {
+            return m_dialogue ? *m_dialogue : DialogueData{};
+        }
+
+        [[nodiscard]] auto CountResponses() const -> size_t
+        {
+            return m_responses.size();
+        }
+
+        //! Returns the available responses, in the order they can be chosen.
+        [[nodiscard]] auto GetResponses() const
+            -> AZStd::span<DialogueHandle const>
+        {
+            return m_responses;
+        }
+
+        /**
+         * @brief Returns an available response by position, starting at 0.
+         *
+         * @returns An invalid handle if the position is out of range.
+         */
+        [[nodiscard]] auto GetResponse(size_t responseIndex) const
+            -> DialogueHandle
+        {
+            return responseIndex < m_responses.size()
+                ? m_responses[responseIndex]
+                : DialogueHandle{};
+        }
+
+    private:
+        DialogueData const* m_dialogue{};
+        AZStd::span<DialogueHandle const> m_responses;
+    };
+} // namespace Conversation
@@ -20,6 +20,15 @@ namespace Conversation
         virtual ~DialogueScriptRequests() = default;
 
         virtual void RunDialogueScript(AZ::Name nodeId) = 0;
+        /**
+         * @brief Runs a function from the companion script's function table.
+         *
+         * Used instead of RunDialogueScript when the dialogue has a script
+         * index, so the function doesn't have to be looked up by name.
+         *
+         * @see DialogueData::GetScriptIndex
+         */
+        virtual void RunDialogueScriptByIndex(AZ::u32 scriptIndex) = 0;
     };
 
     using DialogueScriptRequestBus = AZ::EBus<DialogueScriptRequests>;
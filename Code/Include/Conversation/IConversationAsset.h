@@ -4,9 +4,10 @@
 #include "AzCore/Outcome/Outcome.h"
 #include "AzCore/RTTI/RTTIMacros.h"
 #include "AzCore/Script/ScriptAsset.h"
-#include "AzCore/std/containers/unordered_set.h"
+#include "AzCore/std/containers/span.h"
 #include "AzCore/std/containers/vector.h"
 #include "Conversation/ConversationTypeIds.h"
+#include "Conversation/DialogueHandle.h"
 #include "Conversation/ResponseData.h"
 
 namespace Conversation
@@ -20,9 +21,11 @@ namespace Conversation
      * The interface that objects that manage ConversationAsset or
      * ConversationAsset-like objects implement.
      *
-     * TODO: There's a "Get" and "Copy" version of some functions. I'm not
-     * entirely sure how ScriptCanvas/Lua handle references, so I'm distinguing
-     * them until I find out for sure.
+     * The "Get" functions return views into the asset and never copy. They
+     * are meant for C++ callers and are only valid while the asset is loaded.
+     * The "Copy" functions remain for callers that need to own the data, such
+     * as scripts. Scripts that only need to read a dialogue should use a
+     * DialogueHandle instead.
      */
     class IConversationAsset
     {
@@ -45,11 +48,11 @@ namespace Conversation
         [[nodiscard]] virtual auto CountDialogues() const -> size_t = 0;
 
         /*
-         * @brief Returns a reference to the DialogueIds that can potentially be
+         * @brief Returns a view of the DialogueIds that can potentially be
          * used to start a conversation.
          */
         [[nodiscard]] virtual auto GetStartingIds() const
-            -> AZStd::vector<UniqueId> const& = delete;
+            -> AZStd::span<UniqueId const> = 0;
         /*
          * @brief Returns a copy of the DialogueIds that can potentially be used
          * to start a conversation.
@@ -58,16 +61,15 @@ namespace Conversation
             -> AZStd::vector<UniqueId> = 0;
 
         /*
-         * @brief Returns a reference to the DialogueData objects within the
-         * asset.
+         * @brief Returns a view of the DialogueData objects within the asset.
          */
         [[nodiscard]] virtual auto GetDialogues() const
-            -> AZStd::unordered_set<DialogueData> const& = delete;
+            -> AZStd::span<DialogueData const> = 0;
         /*
          * @brief Returns a copy of the DialogueData objects within the asset.
          */
         [[nodiscard]] virtual auto CopyDialogues() const
-            -> AZStd::unordered_set<DialogueData> = 0;
+            -> AZStd::vector<DialogueData> = 0;
 
         virtual void AddStartingId(UniqueId const& newStartingId) = 0;
         virtual void AddDialogue(DialogueData const& newDialogueData) = 0;
@@ -77,6 +79,13 @@ namespace Conversation
             -> AZ::Outcome<DialogueData> = 0;
         [[nodiscard]] virtual auto CheckDialogueExists(
             UniqueId const& dialogueId) -> bool = 0;
+        /*
+         * @brief Returns a handle to the dialogue with the given ID.
+         *
+         * The handle is invalid if no such dialogue exists.
+         */
+        [[nodiscard]] virtual auto GetDialogueHandle(
+            UniqueId const& dialogueId) const -> DialogueHandle = 0;
 
         [[nodiscard]] virtual auto GetMainScriptAsset() const
             -> AZ::Data::Asset<AZ::ScriptAsset> = 0;
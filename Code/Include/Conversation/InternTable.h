@@ -0,0 +1,200 @@
+#pragma once
+
+#include "AzCore/base.h"
+#include "AzCore/std/containers/deque.h"
+#include "AzCore/std/containers/unordered_map.h"
+#include "AzCore/std/containers/vector.h"
+#include "AzCore/std/parallel/atomic.h"
+#include "AzCore/std/parallel/shared_mutex.h"
+
+namespace Conversation
+{
+    //! Identifies a value held by an InternTable.
+    using InternId = AZ::u32;
+    //! The ID of the empty value. It is always valid.
+    constexpr InternId EmptyInternId{};
+
+    /**
+     * @brief A thread-safe table that stores each distinct value once.
+     *
+     * Values are looked up by hash and referred to by a 32-bit ID. They are
+     * reference counted and removed once nothing refers to them, after which
+     * their ID is reused. ID 0 is always the empty value and is never
+     * reference counted.
+     *
+     * Element addresses are stable, so a value returned by Resolve stays
+     * valid for as long as a reference to it is held.
+     *
+     * @tparam Traits Provides:
+     *  - Value, the type stored.
+     *  - Key, the type values are looked up by. A Value must be assignable
+     *    from a Key.
+     *  - Hash(Key) -> size_t
+     *  - IsEmpty(Key) -> bool
+     *  - Equals(Value, Key) -> bool
+     */
+    template<typename Traits>
+    class InternTable
+    {
+    public:
+        using Value = typename Traits::Value;
+        using Key = typename Traits::Key;
+
+        InternTable()
+        {
+            m_entries.emplace_back();
+            m_entries.back().m_isLive = true;
+            m_liveCount = 1;
+        }
+
+        /**
+         * @brief Returns the ID of a value equal to the key, adding it if
+         *        needed.
+         *
+         * The returned ID holds a reference that must be released.
+         */
+        auto Acquire(Key const& key) -> InternId
+        {
+            if (Traits::IsEmpty(key))
+            {
+                return EmptyInternId;
+            }
+
+            auto const hash = Traits::Hash(key);
+            auto const findAndRetain = [this, &key, hash]() -> InternId
+            {
+                auto const [first, last] = m_idsByHash.equal_range(hash);
+                for (auto iter = first; iter != last; ++iter)
+                {
+                    auto& entry = m_entries[iter->second];
+                    if (Traits::Equals(entry.m_value, key))
+                    {
+                        ++entry.m_refs;
+                        return iter->second;
+                    }
+                }
+                return EmptyInternId;
+            };
+
+            {
+                AZStd::shared_lock lock{ m_mutex };
+                if (auto const id = findAndRetain(); id != EmptyInternId)
+                {
+                    return id;
+                }
+            }
+
+            AZStd::unique_lock lock{ m_mutex };
+            // Another thread may have added it while we waited for the lock.
+            if (auto const id = findAndRetain(); id != EmptyInternId)
+            {
+                return id;
+            }
+
+            InternId id{};
+            if (m_freeIds.empty())
+            {
+                id = static_cast<InternId>(m_entries.size());
+                m_entries.emplace_back();
+            }
+            else
+            {
+                id = m_freeIds.back();
+                m_freeIds.pop_back();
+            }
+
+            auto& entry = m_entries[id];
+            entry.m_value = key;
+            entry.m_hash = hash;
+            entry.m_refs = 1;
+            entry.m_isLive = true;
+            m_idsByHash.emplace(hash, id);
+            ++m_liveCount;
+
+            return id;
+        }
+
+        //! Adds a reference to a value that is already held.
+        void Retain(InternId id)
+        {
+            AZStd::shared_lock lock{ m_mutex };
+            if (id != EmptyInternId && id < m_entries.size())
+            {
+                ++m_entries[id].m_refs;
+            }
+        }
+
+        //! Drops a reference, removing the value if it was the last one.
+        void Release(InternId id)
+        {
+            {
+                AZStd::shared_lock lock{ m_mutex };
+                if (id == EmptyInternId || id >= m_entries.size() ||
+                    --m_entries[id].m_refs > 0)
+                {
+                    return;
+                }
+            }
+
+            AZStd::unique_lock lock{ m_mutex };
+            auto& entry = m_entries[id];
+            // Acquire may have found the value again before we got the lock.
+            if (entry.m_refs > 0 || !entry.m_isLive)
+            {
+                return;
+            }
+
+            auto const [first, last] = m_idsByHash.equal_range(entry.m_hash);
+            for (auto iter = first; iter != last; ++iter)
+            {
+                if (iter->second == id)
+                {
+                    m_idsByHash.erase(iter);
+                    break;
+                }
+            }
+
+            entry.m_value = Value{};
+            entry.m_isLive = false;
+            m_freeIds.push_back(id);
+            --m_liveCount;
+        }
+
+        /**
+         * @brief Returns the value for the ID.
+         *
+         * @returns The value, or the empty value if the ID is unknown.
+         */
+        [[nodiscard]] auto Resolve(InternId id) const -> Value const&
+        {
+            AZStd::shared_lock lock{ m_mutex };
+            return id < m_entries.size() ? m_entries[id].m_value
+                                         : m_entries.front().m_value;
+        }
+
+        //! Returns the number of distinct values, including the empty one.
+        [[nodiscard]] auto Count() const -> size_t
+        {
+            AZStd::shared_lock lock{ m_mutex };
+            return m_liveCount;
+        }
+
+    private:
+        struct Entry
+        {
+            Value m_value{};
+            size_t m_hash{};
+            AZStd::atomic<AZ::u32> m_refs{};
+            bool m_isLive{};
+        };
+
+        mutable AZStd::shared_mutex m_mutex;
+        //! Element addresses stay stable as values are added.
+        AZStd::deque<Entry> m_entries;
+        //! Values that share a hash are told apart by Traits::Equals.
+        AZStd::unordered_multimap<size_t, InternId> m_idsByHash;
+        //! Entries that were released and can be reused.
+        AZStd::vector<InternId> m_freeIds;
+        size_t m_liveCount{};
+    };
+} // namespace Conversation
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "AzCore/RTTI/TypeInfoSimple.h"
+#include "AzCore/std/hash.h"
+#include "AzCore/std/string/string.h"
+
+#include "Conversation/ConversationTypeIds.h"
+#include "Conversation/InternTable.h"
+
+namespace AZ
+{
+    class ReflectContext;
+}
+
+namespace Conversation
+{
+    //! Identifies a string interned in the StringPool.
+    using PooledStringId = InternId;
+    //! The ID of the empty string. It is always valid.
+    constexpr PooledStringId EmptyPooledStringId{ EmptyInternId };
+
+    //! How the StringPool stores and compares its strings.
+    struct PooledStringTraits
+    {
+        using Value = AZStd::string;
+        using Key = AZStd::string_view;
+
+        [[nodiscard]] static auto Hash(Key key) -> size_t
+        {
+            return AZStd::hash<AZStd::string_view>{}(key);
+        }
+
+        [[nodiscard]] static auto IsEmpty(Key key) -> bool
+        {
+            return key.empty();
+        }
+
+        [[nodiscard]] static auto Equals(Value const& value, Key key) -> bool
+        {
+            return AZStd::string_view{ value } == key;
+        }
+    };
+
+    /**
+     * @brief A process-wide table of interned strings.
+     *
+     * Each distinct string is stored once and referred to by a 32-bit ID.
+     * Dialogue text repeats heavily across records (speaker tags in
+     * particular), so dialogues store IDs instead of their own copies.
+     *
+     * The pool lives in the AZ::Environment so that every module sees the same
+     * IDs. Strings are reference counted and removed once nothing refers to
+     * them, so unloading an asset gives back the text only it used. A
+     * string_view returned by Resolve stays valid for as long as a
+     * PooledString to it exists.
+     */
+    class StringPool : public InternTable<PooledStringTraits>
+    {
+    public:
+        //! Returns the pool shared by every module in the process.
+        static auto Get() -> StringPool&;
+
+        /**
+         * @brief Returns the ID for the text, adding it if needed.
+         *
+         * The returned ID holds a reference that must be released.
+         */
+        auto Intern(AZStd::string_view text) -> PooledStringId
+        {
+            return Acquire(text);
+        }
+
+        /**
+         * @brief Returns the text for the ID.
+         *
+         * @returns The text, or an empty string_view if the ID is unknown.
+         * The returned text is null-terminated.
+         */
+        [[nodiscard]] auto Resolve(PooledStringId id) const
+            -> AZStd::string_view
+        {
+            return InternTable::Resolve(id);
+        }
+    };
+
+    /**
+     * @brief A string stored in the StringPool.
+     *
+     * It is the size of its ID, so copying one never allocates and only
+     * touches a reference count. It serializes as its text, which keeps saved
+     * data readable and independent of the order strings were interned in.
+     */
+    class PooledString
+    {
+    public:
+        AZ_TYPE_INFO(PooledString, PooledStringTypeId); // NOLINT
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        PooledString() = default;
+        explicit PooledString(AZStd::string_view text)
+            : m_id(StringPool::Get().Intern(text))
+        {
+        }
+
+        PooledString(PooledString const& other)
+            : m_id(other.m_id)
+        {
+            Retain();
+        }
+
+        PooledString(PooledString&& other) noexcept
+            : m_id(other.m_id)
+        {
+            other.m_id = EmptyPooledStringId;
+        }
+
+        ~PooledString()
+        {
+            Release();
+        }
+
+        auto operator=(PooledString const& other) -> PooledString&
+        {
+            if (m_id != other.m_id)
+            {
+                Release();
+                m_id = other.m_id;
+                Retain();
+            }
+            return *this;
+        }
+
+        auto operator=(PooledString&& other) noexcept -> PooledString&
+        {
+            if (this != &other)
+            {
+                Release();
+                m_id = other.m_id;
+                other.m_id = EmptyPooledStringId;
+            }
+            return *this;
+        }
+
+        [[nodiscard]] auto GetId() const -> PooledStringId
+        {
+            return m_id;
+        }
+
+        [[nodiscard]] auto IsEmpty() const -> bool
+        {
+            return m_id == EmptyPooledStringId;
+        }
+
+        [[nodiscard]] auto GetStringView() const -> AZStd::string_view
+        {
+            return IsEmpty() ? AZStd::string_view{}
+                             : StringPool::Get().Resolve(m_id);
+        }
+
+        [[nodiscard]] auto operator==(PooledString const& other) const -> bool
+        {
+            return m_id == other.m_id;
+        }
+
+        [[nodiscard]] auto operator!=(PooledString const& other) const -> bool
+        {
+            return m_id != other.m_id;
+        }
+
+    private:
+        void Retain() const
+        {
+            if (!IsEmpty())
+            {
+                StringPool::Get().Retain(m_id);
+            }
+        }
+
+        void Release() const
+        {
+            if (!IsEmpty())
+            {
+                StringPool::Get().Release(m_id);
+            }
+        }
+
+        PooledStringId m_id{ EmptyPooledStringId };
+    };
+} // namespace Conversation
@@ -36,6 +36,15 @@ namespace Conversation
             return newDialogueId;
         }
 
+        //! Recreates an ID from the hash returned by GetHash().
+        static auto CreateFromHash(AZ::Name::Hash hash) -> UniqueId
+        {
+            UniqueId newDialogueId{};
+            newDialogueId.m_value = hash;
+
+            return newDialogueId;
+        }
+
         static auto CreateRandomId() -> UniqueId
         {
             return CreateNamedId(AZ::Uuid::CreateRandom().ToFixedString());
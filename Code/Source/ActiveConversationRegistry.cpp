@@ -0,0 +1,48 @@
+#include "ActiveConversationRegistry.h"
+
+namespace Conversation
+{
+    void ActiveConversationRegistry::Add(
+        ActiveConversation const& conversation)
+    {
+        Remove(conversation.m_target);
+        m_conversations.emplace(conversation.m_target, conversation);
+        ++m_initiators[conversation.m_initiator];
+    }
+
+    void ActiveConversationRegistry::Remove(AZ::EntityId target)
+    {
+        auto const iter = m_conversations.find(target);
+        if (iter == m_conversations.end())
+        {
+            return;
+        }
+
+        auto const initiator = m_initiators.find(iter->second.m_initiator);
+        if (initiator != m_initiators.end() && --initiator->second == 0)
+        {
+            m_initiators.erase(initiator);
+        }
+        m_conversations.erase(iter);
+    }
+
+    void ActiveConversationRegistry::Clear()
+    {
+        m_conversations.clear();
+        m_initiators.clear();
+    }
+
+    auto ActiveConversationRegistry::IsInConversation(
+        AZ::EntityId entityId) const -> bool
+    {
+        return m_conversations.find(entityId) != m_conversations.end() ||
+            m_initiators.find(entityId) != m_initiators.end();
+    }
+
+    auto ActiveConversationRegistry::Find(AZ::EntityId target) const
+        -> ActiveConversation const*
+    {
+        auto const iter = m_conversations.find(target);
+        return iter != m_conversations.end() ? &iter->second : nullptr;
+    }
+} // namespace Conversation
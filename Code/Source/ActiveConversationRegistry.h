@@ -0,0 +1,43 @@
+#pragma once
+
+#include "AzCore/Component/EntityId.h"
+#include "AzCore/std/containers/unordered_map.h"
+
+#include "Conversation/ConversationBus.h"
+
+namespace Conversation
+{
+    /**
+     * @brief Keeps track of every conversation in progress.
+     *
+     * Conversations are keyed by their target, and initiators are counted
+     * separately, so asking whether an entity is in a conversation is a
+     * lookup either way.
+     */
+    class ActiveConversationRegistry
+    {
+    public:
+        //! Replaces any conversation the target was already registered in.
+        void Add(ActiveConversation const& conversation);
+        //! Does nothing if the target isn't in a conversation.
+        void Remove(AZ::EntityId target);
+        void Clear();
+
+        //! True if the entity is the target or initiator of a conversation.
+        [[nodiscard]] auto IsInConversation(AZ::EntityId entityId) const
+            -> bool;
+
+        [[nodiscard]] auto Find(AZ::EntityId target) const
+            -> ActiveConversation const*;
+
+        [[nodiscard]] auto CountConversations() const -> size_t
+        {
+            return m_conversations.size();
+        }
+
+    private:
+        AZStd::unordered_map<AZ::EntityId, ActiveConversation> m_conversations;
+        // How many conversations each initiator has started.
+        AZStd::unordered_map<AZ::EntityId, AZ::u32> m_initiators;
+    };
+} // namespace Conversation
@@ -44,7 +44,7 @@ namespace ConversationEditor
         builderDescriptor.m_busId =
             azrtti_typeid<ConversationAssetBuilderWorker>();
         builderDescriptor.m_version =
-            1; // if you change this, all assets will automatically rebuild
+            9; // if you change this, all assets will automatically rebuild
         builderDescriptor.m_analysisFingerprint =
             ""; // if you change this, all assets will re-analyze but not
                 // necessarily rebuild.
@@ -8,6 +8,7 @@
 
 #include "AzCore/StringFunc/StringFunc.h"
 #include "Conversation/ConversationAsset.h"
+#include "Conversation/ConversationAssetFormat.h"
 
 namespace ConversationEditor
 {
@@ -130,12 +131,13 @@ namespace ConversationEditor
             AssetBuilderSDK::InfoWindow,
             "Loading/deserializing the conversation document.\n"); // NOLINT
 
-        AZStd::unique_ptr<Conversation::ConversationAsset> conversationAsset{
-            AZ::Utils::LoadObjectFromFile<Conversation::ConversationAsset>(
-                request.m_fullPath.c_str())
-        };
+        auto const conversationAsset =
+            AZStd::make_unique<Conversation::ConversationAsset>();
+        auto const loadOutcome =
+            Conversation::AssetFormat::LoadConversationAssetFromFile(
+                request.m_fullPath, *conversationAsset);
 
-        if (conversationAsset)
+        if (loadOutcome.IsSuccess())
         {
             AZ_TracePrintf(
                 AssetBuilderSDK::InfoWindow,
@@ -148,7 +150,8 @@ namespace ConversationEditor
             AZ_TracePrintf(
                 AssetBuilderSDK::ErrorWindow,
                 "Job failed. Unable to load/deserialize the conversation "
-                "document.\n");
+                "document: %s\n",
+                loadOutcome.GetError().c_str());
             return;
         }
 
@@ -181,18 +184,53 @@ namespace ConversationEditor
             return;
         }
 
-        // Save the asset to the temp destination path.
-        bool const success =
-            AZ::Utils::SaveObjectToFile<Conversation::ConversationAsset>(
-                destPath.c_str(),
-                AZ::DataStream::ST_JSON,
-                conversationAsset.get());
+        // The debug sidecar is written first, while the asset still has its
+        // editor-only data.
+        AZStd::string debugFileName = fileName;
+        AzFramework::StringFunc::Path::ReplaceExtension(
+            debugFileName,
+            Conversation::ConversationAsset::DebugProductDotExtension);
 
-        if (!success)
+        AZStd::string debugDestPath;
+        AzFramework::StringFunc::Path::ConstructFull(
+            request.m_tempDirPath.c_str(),
+            debugFileName.c_str(),
+            debugDestPath,
+            true);
+
+        auto const debugSaveOutcome =
+            Conversation::AssetFormat::SaveConversationAssetToFile(
+                *conversationAsset, debugDestPath);
+
+        conversationAsset->StripEditorData();
+
+        // The runtime product leaves its chunk text in a product of its own,
+        // which is streamed in as dialogues are reached.
+        AZStd::string chunkTextFileName = fileName;
+        AzFramework::StringFunc::Path::ReplaceExtension(
+            chunkTextFileName,
+            Conversation::ConversationAsset::ChunkTextProductDotExtension);
+
+        AZStd::string chunkTextDestPath;
+        AzFramework::StringFunc::Path::ConstructFull(
+            request.m_tempDirPath.c_str(),
+            chunkTextFileName.c_str(),
+            chunkTextDestPath,
+            true);
+
+        // Save the asset to the temp destination path in the binary product
+        // layout, regardless of how the source was stored.
+        auto const saveOutcome = debugSaveOutcome.IsSuccess()
+            ? Conversation::AssetFormat::SaveConversationAssetToFile(
+                  *conversationAsset, destPath, chunkTextDestPath)
+            : debugSaveOutcome;
+
+        if (!saveOutcome.IsSuccess())
         {
             AZ_TracePrintf( // NOLINT
                 AssetBuilderSDK::ErrorWindow,
-                "Job failed. Could not save to temporary folder.\n");
+                "Job failed. Could not save to temporary folder: %s\n",
+                saveOutcome.GetError().c_str());
 
             response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
             return;
@@ -209,11 +247,37 @@ namespace ConversationEditor
             AZ::AzTypeInfo<Conversation::ConversationAsset>::Uuid();
         jobProduct.m_productSubID =
             Conversation::ConversationAsset::ProductAssetSubId;
+        // The text has to ship with the asset, but is never preloaded with it.
+        jobProduct.m_dependencies.emplace_back(
+            Conversation::ConversationAsset::GetChunkTextAssetId(
+                AZ::Data::AssetId{
+                    request.m_sourceFileUUID,
+                    Conversation::ConversationAsset::ProductAssetSubId }),
+            AZ::Data::ProductDependencyInfo::CreateFlags(
+                AZ::Data::AssetLoadBehavior::NoLoad));
         jobProduct.m_dependenciesHandled = true;
 
         // once you've filled up the details of the product in jobProduct, add
         // it to the result list:
         response.m_outputProducts.push_back(jobProduct);
+
+        // Nothing depends on the sidecar, so it is only bundled or loaded when
+        // something asks for it by ID.
+        AssetBuilderSDK::JobProduct debugJobProduct(debugFileName);
+        debugJobProduct.m_productAssetType =
+            AZ::AzTypeInfo<Conversation::ConversationAsset>::Uuid();
+        debugJobProduct.m_productSubID =
+            Conversation::ConversationAsset::DebugProductAssetSubId;
+        debugJobProduct.m_dependenciesHandled = true;
+        response.m_outputProducts.push_back(debugJobProduct);
+
+        AssetBuilderSDK::JobProduct chunkTextJobProduct(chunkTextFileName);
+        chunkTextJobProduct.m_productAssetType =
+            AZ::Data::AssetType{ Conversation::ConversationChunkTextTypeId };
+        chunkTextJobProduct.m_productSubID =
+            Conversation::ConversationAsset::ChunkTextProductAssetSubId;
+        chunkTextJobProduct.m_dependenciesHandled = true;
+        response.m_outputProducts.push_back(chunkTextJobProduct);
         response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Success;
 
         AZ_TracePrintf( // NOLINT
@@ -0,0 +1,220 @@
+#include "Conversation/ChunkTextStore.h"
+
+#include "AzCore/IO/IStreamer.h"
+#include "AzCore/Interface/Interface.h"
+
+namespace Conversation
+{
+    ChunkTextStore::ChunkTextStore(
+        AZStd::string streamName,
+        AZ::u64 baseOffset,
+        AZStd::vector<AssetFormat::StringRef> chunkRefs)
+        : m_streamName(AZStd::move(streamName))
+        , m_baseOffset(baseOffset)
+        , m_chunkRefs(AZStd::move(chunkRefs))
+    {
+    }
+
+    void ChunkTextStore::Load(
+        AZStd::span<DialogueIndex const> indices, OnLoadedCallback onLoaded)
+    {
+        auto const pendingLoad = AZStd::make_shared<PendingLoad>();
+        pendingLoad->m_onLoaded = AZStd::move(onLoaded);
+        // Held until every read is queued, so an early completion can't
+        // finish the load before the rest have started.
+        pendingLoad->m_remaining = 1;
+
+        {
+            AZStd::scoped_lock lock{ m_mutex };
+
+            for (DialogueIndex const index : indices)
+            {
+                if (index >= m_chunkRefs.size())
+                {
+                    continue;
+                }
+
+                auto& entry = m_entries[index];
+                ++entry.m_holds;
+
+                if (entry.m_isLoaded)
+                {
+                    continue;
+                }
+
+                if (m_chunkRefs[index].m_size == 0)
+                {
+                    entry.m_isLoaded = true;
+                    continue;
+                }
+
+                ++pendingLoad->m_remaining;
+                entry.m_waiters.push_back(pendingLoad);
+
+                if (!entry.m_isReading)
+                {
+                    StartRead(index, entry);
+                }
+            }
+
+            if (--pendingLoad->m_remaining > 0)
+            {
+                return;
+            }
+        }
+
+        Finish({ pendingLoad });
+    }
+
+    void ChunkTextStore::Release(AZStd::span<DialogueIndex const> indices)
+    {
+        AZStd::scoped_lock lock{ m_mutex };
+
+        for (DialogueIndex const index : indices)
+        {
+            auto const iter = m_entries.find(index);
+            if (iter == m_entries.end())
+            {
+                continue;
+            }
+
+            auto& entry = iter->second;
+            if (entry.m_holds > 0)
+            {
+                --entry.m_holds;
+            }
+
+            // The streamer is still writing into an entry that is being read,
+            // so those are erased once the read completes.
+            if (entry.m_holds == 0 && !entry.m_isReading)
+            {
+                m_entries.erase(iter);
+            }
+        }
+    }
+
+    auto ChunkTextStore::IsLoaded(DialogueIndex index) const -> bool
+    {
+        AZStd::scoped_lock lock{ m_mutex };
+        auto const iter = m_entries.find(index);
+        return iter != m_entries.end() && iter->second.m_isLoaded;
+    }
+
+    auto ChunkTextStore::Find(DialogueIndex index) const -> AZStd::string_view
+    {
+        AZStd::scoped_lock lock{ m_mutex };
+        auto const iter = m_entries.find(index);
+        return iter != m_entries.end() && iter->second.m_isLoaded
+            ? AZStd::string_view{ iter->second.m_text }
+            : AZStd::string_view{};
+    }
+
+    void ChunkTextStore::StartRead(DialogueIndex index, Entry& entry)
+    {
+        auto* const streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+        if (!streamer)
+        {
+            AZ_Error( // NOLINT
+                "ChunkTextStore",
+                false,
+                "Unable to stream dialogue text without AZ::IO::Streamer.");
+
+            // Only the caller's load is waiting, since nothing was reading.
+            entry.m_isLoaded = true;
+            for (auto const& waiter : entry.m_waiters)
+            {
+                --waiter->m_remaining;
+            }
+            entry.m_waiters.clear();
+            return;
+        }
+
+        auto const ref = m_chunkRefs[index];
+        entry.m_isReading = true;
+        entry.m_text.resize(ref.m_size);
+
+        AZ::IO::FileRequestPtr request = streamer->Read(
+            m_streamName,
+            entry.m_text.data(),
+            entry.m_text.size(),
+            ref.m_size,
+            AZ::IO::IStreamerTypes::s_noDeadline,
+            AZ::IO::IStreamerTypes::s_priorityMedium,
+            m_baseOffset + ref.m_offset);
+
+        // The store has to outlive the read, since the streamer writes into
+        // one of its entries.
+        streamer->SetRequestCompleteCallback(
+            request,
+            [self = shared_from_this(), index](AZ::IO::FileRequestHandle handle)
+            {
+                auto* const streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+                bool const succeeded = streamer &&
+                    streamer->GetRequestStatus(handle) ==
+                        AZ::IO::IStreamerTypes::RequestStatus::Completed;
+
+                self->OnReadComplete(index, succeeded);
+            });
+
+        streamer->QueueRequest(request);
+    }
+
+    void ChunkTextStore::OnReadComplete(DialogueIndex index, bool succeeded)
+    {
+        AZStd::vector<AZStd::shared_ptr<PendingLoad>> finishedLoads;
+
+        {
+            AZStd::scoped_lock lock{ m_mutex };
+
+            auto const iter = m_entries.find(index);
+            if (iter == m_entries.end())
+            {
+                return;
+            }
+
+            auto& entry = iter->second;
+            AZ_Warning( // NOLINT
+                "ChunkTextStore",
+                succeeded,
+                "Failed to stream the text of dialogue %u from '%s'.",
+                index,
+                m_streamName.c_str());
+
+            if (!succeeded)
+            {
+                entry.m_text.clear();
+            }
+
+            entry.m_isReading = false;
+            entry.m_isLoaded = true;
+
+            for (auto const& waiter : entry.m_waiters)
+            {
+                if (--waiter->m_remaining == 0)
+                {
+                    finishedLoads.push_back(waiter);
+                }
+            }
+            entry.m_waiters.clear();
+
+            if (entry.m_holds == 0)
+            {
+                m_entries.erase(iter);
+            }
+        }
+
+        Finish(finishedLoads);
+    }
+
+    void ChunkTextStore::Finish(
+        AZStd::vector<AZStd::shared_ptr<PendingLoad>> const& loads)
+    {
+        for (auto const& load : loads)
+        {
+            if (load->m_onLoaded)
+            {
+                load->m_onLoaded();
+            }
+        }
+    }
+} // namespace Conversation
@@ -3,6 +3,8 @@
 #include "AzCore/Asset/AssetSerializer.h"
 #include "AzCore/Component/Entity.h"
 #include "AzCore/Outcome/Outcome.h"
+#include "AzCore/RTTI/BehaviorContext.h"
+#include "AzCore/Script/ScriptContextAttributes.h"
 #include "AzCore/Serialization/EditContext.h"
 #include "AzCore/Serialization/EditContextConstants.inl"
 #include "AzCore/Serialization/SerializeContext.h"
@@ -48,6 +50,31 @@ namespace Conversation
                         "");
             }
         }
+
+        if (auto* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext
+                ->EBus<ConversationAssetRefComponentRequestBus>(
+                    "ConversationAssetRefComponentRequestBus")
+                ->Attribute(
+                    AZ::Script::Attributes::Category, DialogueSystemCategory)
+                ->Attribute(
+                    AZ::Script::Attributes::Module, DialogueSystemModule)
+                ->Attribute(
+                    AZ::Script::Attributes::Scope,
+                    AZ::Script::Attributes::ScopeFlags::Common)
+                ->Event(
+                    "CountDialogues",
+                    &ConversationAssetRefComponentRequests::CountDialogues)
+                ->Event(
+                    "CountStartingIds",
+                    &ConversationAssetRefComponentRequests::CountStartingIds)
+                ->Event(
+                    "GetDialogueHandle",
+                    &ConversationAssetRefComponentRequests::GetDialogueHandle,
+                    { { { "DialogueId",
+                          "The ID of the dialogue to get a handle to." } } });
+        }
     }
 
     void ConversationAssetRefComponent::Init()
@@ -135,12 +162,26 @@ namespace Conversation
         return m_asset ? m_asset->CountDialogues() : 0;
     }
 
+    auto ConversationAssetRefComponent::GetStartingIds() const
+        -> AZStd::span<UniqueId const>
+    {
+        return m_asset ? m_asset->GetStartingIds()
+                       : AZStd::span<UniqueId const>{};
+    }
+
     auto ConversationAssetRefComponent::CopyStartingIds() const
         -> AZStd::vector<UniqueId>
     {
         return m_asset ? m_asset->CopyStartingIds() : AZStd::vector<UniqueId>{};
     }
 
+    auto ConversationAssetRefComponent::GetDialogues() const
+        -> AZStd::span<DialogueData const>
+    {
+        return m_asset ? m_asset->GetDialogues()
+                       : AZStd::span<DialogueData const>{};
+    }
+
     auto ConversationAssetRefComponent::CopyDialogues() const
         -> DialogueDataContainer
     {
@@ -176,6 +217,13 @@ namespace Conversation
         return m_asset ? m_asset->CheckDialogueExists(dialogueId) : false;
     }
 
+    auto ConversationAssetRefComponent::GetDialogueHandle(
+        UniqueId const& dialogueId) const -> DialogueHandle
+    {
+        return m_asset ? m_asset->GetDialogueHandle(dialogueId)
+                       : DialogueHandle{};
+    }
+
     auto ConversationAssetRefComponent::GetMainScriptAsset() const
         -> AZ::Data::Asset<AZ::ScriptAsset>
     {
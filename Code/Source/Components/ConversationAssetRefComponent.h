@@ -40,11 +40,17 @@ namespace Conversation
 
         [[nodiscard]] auto CountDialogues() const -> size_t override;
 
+        [[nodiscard]] auto GetStartingIds() const
+            -> AZStd::span<UniqueId const> override;
+
         [[nodiscard]] auto CopyStartingIds() const
             -> AZStd::vector<UniqueId> override;
 
+        [[nodiscard]] auto GetDialogues() const
+            -> AZStd::span<DialogueData const> override;
+
         [[nodiscard]] auto CopyDialogues() const
-            -> AZStd::unordered_set<DialogueData> override;
+            -> AZStd::vector<DialogueData> override;
 
         void AddStartingId(UniqueId const& newStartingId) override;
         void AddDialogue(DialogueData const& newDialogueData) override;
@@ -54,6 +60,8 @@ namespace Conversation
             -> AZ::Outcome<DialogueData> override;
         [[nodiscard]] auto CheckDialogueExists(UniqueId const& dialogueId)
             -> bool override;
+        [[nodiscard]] auto GetDialogueHandle(UniqueId const& dialogueId) const
+            -> DialogueHandle override;
         [[nodiscard]] auto GetMainScriptAsset() const
             -> AZ::Data::Asset<AZ::ScriptAsset> override;
 
@@ -25,12 +25,24 @@ namespace Conversation
         if (auto serialize = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serialize->Class<DialogueComponentConfig, AZ::ComponentConfig>()
-                ->Version(4)
+                ->Version(8)
                 ->Field("Display Name", &DialogueComponentConfig::m_displayName)
                 ->Field(
                     "Speaker Icon", &DialogueComponentConfig::m_speakerIconPath)
                 ->Field("Script", &DialogueComponentConfig::m_companionScript)
-                ->Field("Speaker Tag", &DialogueComponentConfig::m_speakerTag);
+                ->Field("Speaker Tag", &DialogueComponentConfig::m_speakerTag)
+                ->Field(
+                    "Precompute Next Level",
+                    &DialogueComponentConfig::m_precomputeNextLevel)
+                ->Field(
+                    "Queue Notifications",
+                    &DialogueComponentConfig::m_queueNotifications)
+                ->Field(
+                    "Cache Availability",
+                    &DialogueComponentConfig::m_cacheAvailability)
+                ->Field(
+                    "Mirror Conversation Tags",
+                    &DialogueComponentConfig::m_mirrorConversationTags);
 
             if (auto editContext = serialize->GetEditContext())
             {
@@ -61,7 +73,40 @@ namespace Conversation
                         &DialogueComponentConfig::m_speakerIconPath,
                         "Speaker Icon Path",
                         "")
-                    ->Attribute(AZ::Edit::Attributes::Visibility, true);
+                    ->Attribute(AZ::Edit::Attributes::Visibility, true)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &DialogueComponentConfig::m_precomputeNextLevel,
+                        "Precompute Next Level",
+                        "While a dialogue is on screen, work out the responses "
+                        "of each of its responses, spread over the following "
+                        "frames. Selecting a response then uses the results "
+                        "instead of checking availability again.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &DialogueComponentConfig::m_queueNotifications,
+                        "Queue Notifications",
+                        "Send conversation notifications once per tick, "
+                        "instead of from inside the call that caused them. "
+                        "A dialogue replaced within the same tick is never "
+                        "sent.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &DialogueComponentConfig::m_cacheAvailability,
+                        "Cache Availability",
+                        "Ask each availability check once, then reuse the "
+                        "answer until the world state epoch moves. Only turn "
+                        "this on if the game calls BumpWorldStateEpoch, or "
+                        "sets facts, whenever something the checks read "
+                        "changes.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &DialogueComponentConfig::m_mirrorConversationTags,
+                        "Mirror Conversation Tags",
+                        "Add the active and player conversation tags while in "
+                        "a conversation. Only needed by scripts that look for "
+                        "the tags instead of asking the "
+                        "ConversationRequestBus.");
             }
         }
     }
@@ -1,12 +1,14 @@
 #include "Conversation/ConversationAsset.h"
 
 #include "AzCore/Asset/AssetCommon.h"
+#include "AzCore/Asset/AssetManagerBus.h"
 #include "AzCore/Asset/AssetSerializer.h"
 #include "AzCore/Console/ILogger.h"
 #include "AzCore/RTTI/BehaviorContext.h"
 #include "AzCore/Script/ScriptContextAttributes.h"
 #include "AzCore/Serialization/EditContext.h"
 #include "AzCore/Serialization/EditContextConstants.inl"
+#include "AzCore/Serialization/Utils.h"
 #include "Conversation/Constants.h"
 #include "Conversation/ConversationTypeIds.h"
 #include "Conversation/IConversationAsset.h"
@@ -21,8 +23,27 @@ namespace Conversation
     AZ_CLASS_ALLOCATOR_IMPL(
         ConversationAsset, AZ::SystemAllocator, 0); // NOLINT
 
+    /**
+     * Rebuilds the dialogue lookup table and response graph after an asset
+     * has been read in, since only the dialogues themselves are serialized.
+     */
+    class ConversationAssetSerializationEvents
+        : public AZ::SerializeContext::IEventHandler
+    {
+    public:
+        void OnReadEnd(void* classPtr) override
+        {
+            auto* const asset = static_cast<ConversationAsset*>(classPtr);
+            asset->RebuildDialogueIndices();
+            asset->RebuildResponseGraph();
+            asset->ResolveAvailabilityKeys();
+        }
+    };
+
     void ConversationAsset::Reflect(AZ::ReflectContext* context)
     {
+        DialogueHandle::Reflect(context);
+
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<IConversationAsset>()->Version(0);
@@ -31,7 +52,8 @@ namespace Conversation
                     ConversationAsset,
                     AZ::Data::AssetData,
                     IConversationAsset>()
-                ->Version(1)
+                ->Version(2)
+                ->EventHandler<ConversationAssetSerializationEvents>()
                 ->Field("Chunks", &ConversationAsset::m_chunks)
                 ->Field("Comment", &ConversationAsset::m_comment)
                 ->Field("Dialogues", &ConversationAsset::m_dialogues)
@@ -64,7 +86,12 @@ namespace Conversation
                 ->Attribute(AZ::Script::Attributes::ConstructibleFromNil, true)
                 ->Attribute(
                     AZ::Script::Attributes::Scope,
-                    AZ::Script::Attributes::ScopeFlags::Common);
+                    AZ::Script::Attributes::ScopeFlags::Common)
+                ->Method("CountDialogues", &ConversationAsset::CountDialogues)
+                ->Method(
+                    "CountStartingIds", &ConversationAsset::CountStartingIds)
+                ->Method(
+                    "GetDialogueHandle", &ConversationAsset::GetDialogueHandle);
         }
     }
 
@@ -109,7 +136,7 @@ namespace Conversation
             return;
         }
 
-        if (m_dialogues.contains(newDialogueData))
+        if (CheckDialogueExists(newDialogueData.GetId()))
         {
             AZ_Warning( // NOLINT
                 "ConversationAsset",
@@ -119,7 +146,22 @@ namespace Conversation
             return;
         }
 
-        m_dialogues.insert(newDialogueData);
+        // The perfect hash can't grow, so edits switch over to the map.
+        if (!m_dialogueLookup.IsEmpty())
+        {
+            m_dialogueLookup.Clear();
+            RebuildDialogueIndexMap();
+        }
+
+        m_dialogueIndices.emplace(
+            newDialogueData.GetId(),
+            static_cast<DialogueIndex>(m_dialogues.size()));
+        m_dialogues.push_back(newDialogueData);
+        // The new dialogue may resolve response IDs that were dangling.
+        m_responseOffsets.clear();
+        m_availabilityKeyText.clear();
+        m_availabilityKeyRefs.clear();
+        m_audioTriggerIds.clear();
     }
 
     void ConversationAsset::AddResponse(ResponseData const& responseData)
@@ -132,12 +174,8 @@ namespace Conversation
             return;
         }
 
-        auto iter = AZStd::ranges::find_if(
-            m_dialogues,
-            [&responseData](DialogueData const& dialogueData) -> bool
-            {
-                return dialogueData.GetId() == responseData.m_parentDialogueId;
-            });
+        auto const parentIndex =
+            GetDialogueIndex(responseData.m_parentDialogueId);
 
         // We add response data without confirming if we have a DialogueData
         // with the parent DialogueId. We don't require that either exist in
@@ -145,23 +183,300 @@ namespace Conversation
         m_responses.push_back(responseData);
 
         // Exit if the parent dialogue wasn't found.
-        if (iter == m_dialogues.end())
+        if (parentIndex == InvalidDialogueIndex)
         {
             return;
         }
 
         // If it was found, we also add the response directly to the
         // DialogueData.
-        iter->AddDialogueResponseId(responseData);
+        m_dialogues[parentIndex].AddDialogueResponseId(responseData);
+        m_responseOffsets.clear();
     }
 
     auto ConversationAsset::GetDialogueById(UniqueId const& dialogueId)
         -> AZ::Outcome<DialogueData>
     {
-        auto iter = m_dialogues.find(DialogueData(dialogueId));
-        return iter != m_dialogues.end()
-            ? AZ::Success(*iter)
-            : AZ::Outcome<DialogueData>(AZ::Failure());
+        auto const* const dialogue = FindDialogue(dialogueId);
+        return dialogue ? AZ::Success(*dialogue)
+                        : AZ::Outcome<DialogueData>(AZ::Failure());
+    }
+
+    void ConversationAsset::RebuildDialogueIndices()
+    {
+        m_dialogueIndices.clear();
+
+        if (m_dialogueLookup.Build(CollectDialogueIds()))
+        {
+            return;
+        }
+
+        // Repeated IDs can't be perfectly hashed.
+        RebuildDialogueIndexMap();
+    }
+
+    auto ConversationAsset::CollectDialogueIds() const
+        -> AZStd::vector<AZ::u32>
+    {
+        AZStd::vector<AZ::u32> ids;
+        ids.reserve(m_dialogues.size());
+        for (DialogueData const& dialogue : m_dialogues)
+        {
+            ids.push_back(dialogue.GetId().GetHash());
+        }
+
+        return ids;
+    }
+
+    void ConversationAsset::RebuildDialogueIndexMap()
+    {
+        m_dialogueIndices.clear();
+        m_dialogueIndices.reserve(m_dialogues.size());
+
+        for (DialogueIndex index{}; index < m_dialogues.size(); ++index)
+        {
+            auto const [iter, inserted] =
+                m_dialogueIndices.emplace(m_dialogues[index].GetId(), index);
+
+            AZ_Warning( // NOLINT
+                "ConversationAsset",
+                inserted,
+                "Duplicate dialogue ID '%u' found while rebuilding the "
+                "dialogue table. Only the first one will be used.\n",
+                m_dialogues[index].GetId().GetHash());
+        }
+    }
+
+    void ConversationAsset::SetChunkTextSource(
+        AZStd::string streamName, AZ::u64 baseOffset)
+    {
+        m_chunkTextStore = AZStd::make_shared<ChunkTextStore>(
+            AZStd::move(streamName), baseOffset, m_chunkTextRefs);
+    }
+
+    auto ConversationAsset::GetChunkText(DialogueIndex index) const
+        -> AZStd::string_view
+    {
+        if (index >= m_dialogues.size())
+        {
+            return {};
+        }
+
+        if (IsChunkTextStreamed())
+        {
+            return m_chunkTextStore ? m_chunkTextStore->Find(index)
+                                    : AZStd::string_view{};
+        }
+
+        return m_dialogues[index].GetChunkAsText();
     }
 
+    void ConversationAsset::ResolveAvailabilityKeys()
+    {
+        m_availabilityKeyText.clear();
+        m_availabilityKeyRefs.clear();
+        m_availabilityKeyRefs.reserve(m_dialogues.size());
+
+        for (DialogueData const& dialogue : m_dialogues)
+        {
+            AZ::Name const key{ dialogue.GetAvailabilityId().GetHash() };
+            auto const keyText = key.GetStringView();
+            m_availabilityKeyRefs.push_back(AssetFormat::StringRef{
+                static_cast<AZ::u32>(m_availabilityKeyText.size()),
+                static_cast<AZ::u32>(keyText.size()) });
+            m_availabilityKeyText.append(keyText.data(), keyText.size());
+        }
+    }
+
+    auto ConversationAsset::GetAvailabilityKey(DialogueIndex index) const
+        -> AZStd::string_view
+    {
+        if (index >= m_availabilityKeyRefs.size())
+        {
+            return {};
+        }
+
+        auto const ref = m_availabilityKeyRefs[index];
+        return AZStd::string_view{ m_availabilityKeyText }.substr(
+            ref.m_offset, ref.m_size);
+    }
+
+    auto ConversationAsset::ResolveAudioTriggers(
+        AZStd::function<AZ::u64(DialogueAudioControl const&)> const& resolve)
+        -> AZStd::vector<DialogueIndex>
+    {
+        AZStd::vector<DialogueIndex> missing;
+        m_audioTriggerIds.clear();
+        m_audioTriggerIds.reserve(m_dialogues.size());
+
+        for (DialogueIndex index{}; index < m_dialogues.size(); ++index)
+        {
+            auto const& audioControl = m_dialogues[index].GetAudioControl();
+            if (audioControl.IsEmpty())
+            {
+                m_audioTriggerIds.push_back(NoAudioTrigger);
+                continue;
+            }
+
+            auto const triggerId = resolve(audioControl);
+            if (triggerId == NoAudioTrigger)
+            {
+                missing.push_back(index);
+            }
+            m_audioTriggerIds.push_back(triggerId);
+        }
+
+        return missing;
+    }
+
+    void ConversationAsset::StripEditorData()
+    {
+        if (!HasAvailabilityKeys())
+        {
+            ResolveAvailabilityKeys();
+        }
+
+        m_comment = {};
+        m_names = {};
+        m_responses = {};
+
+        for (DialogueData& dialogue : m_dialogues)
+        {
+            dialogue.SetComment(AZStd::string_view{});
+        }
+    }
+
+    void ConversationAsset::RebuildResponseGraph()
+    {
+        BuildResponseGraph(m_responseOffsets, m_responseIndices);
+    }
+
+    void ConversationAsset::BuildResponseGraph(
+        ResponseOffsetContainer& offsets,
+        ResponseIndexContainer& indices) const
+    {
+        offsets.clear();
+        indices.clear();
+        offsets.reserve(m_dialogues.size() + 1);
+
+        for (DialogueData const& dialogue : m_dialogues)
+        {
+            offsets.push_back(static_cast<AZ::u32>(indices.size()));
+
+            for (UniqueId const& responseId : dialogue.GetResponseIds())
+            {
+                if (auto const responseIndex = GetDialogueIndex(responseId);
+                    responseIndex != InvalidDialogueIndex)
+                {
+                    indices.push_back(responseIndex);
+                }
+            }
+        }
+
+        offsets.push_back(static_cast<AZ::u32>(indices.size()));
+    }
+
+    auto ConversationAssetHandler::LoadAssetData(
+        AZ::Data::Asset<AZ::Data::AssetData> const& asset,
+        AZStd::shared_ptr<AZ::Data::AssetDataStream> stream,
+        AZ::Data::AssetFilterCB const& assetLoadFilterCB)
+        -> AZ::Data::AssetHandler::LoadResult
+    {
+        auto* const conversationAsset = asset.GetAs<ConversationAsset>();
+        if (!conversationAsset)
+        {
+            AZ_Error( // NOLINT
+                "ConversationAssetHandler",
+                false,
+                "Asset '%s' is not a conversation asset.",
+                asset.GetHint().c_str());
+            return AZ::Data::AssetHandler::LoadResult::Error;
+        }
+
+        AZStd::vector<AZ::u8> buffer(stream->GetLength());
+        if (stream->Read(buffer.size(), buffer.data()) != buffer.size())
+        {
+            AZ_Error( // NOLINT
+                "ConversationAssetHandler",
+                false,
+                "Failed to read conversation asset '%s'.",
+                asset.GetHint().c_str());
+            return AZ::Data::AssetHandler::LoadResult::Error;
+        }
+
+        if (!AssetFormat::IsBinaryProduct(buffer))
+        {
+            bool const loaded = AZ::Utils::LoadObjectFromBufferInPlace(
+                buffer.data(),
+                buffer.size(),
+                *conversationAsset,
+                m_serializeContext,
+                AZ::ObjectStream::FilterDescriptor(assetLoadFilterCB));
+
+            return loaded ? AZ::Data::AssetHandler::LoadResult::LoadComplete
+                          : AZ::Data::AssetHandler::LoadResult::Error;
+        }
+
+        auto const outcome =
+            AssetFormat::ReadConversationAsset(buffer, *conversationAsset);
+        if (!outcome.IsSuccess())
+        {
+            AZ_Error( // NOLINT
+                "ConversationAssetHandler",
+                false,
+                "Failed to load conversation asset '%s': %s",
+                asset.GetHint().c_str(),
+                outcome.GetError().c_str());
+            return AZ::Data::AssetHandler::LoadResult::Error;
+        }
+
+        if (conversationAsset->IsChunkTextStreamed())
+        {
+            // Only the text product's location is needed now. Its contents
+            // are streamed in as dialogues are reached.
+            AZ::Data::AssetStreamInfo streamInfo{};
+            AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+                streamInfo,
+                &AZ::Data::AssetCatalogRequests::GetStreamInfoForLoad,
+                ConversationAsset::GetChunkTextAssetId(asset.GetId()),
+                AZ::Data::AssetType{ ConversationChunkTextTypeId });
+
+            if (!streamInfo.IsValid())
+            {
+                AZ_Error( // NOLINT
+                    "ConversationAssetHandler",
+                    false,
+                    "Unable to find the text of conversation asset '%s'.",
+                    asset.GetHint().c_str());
+                return AZ::Data::AssetHandler::LoadResult::Error;
+            }
+
+            conversationAsset->SetChunkTextSource(
+                streamInfo.m_streamName, streamInfo.m_dataOffset);
+        }
+
+        return AZ::Data::AssetHandler::LoadResult::LoadComplete;
+    }
+
+    auto ConversationAssetHandler::SaveAssetData(
+        AZ::Data::Asset<AZ::Data::AssetData> const& asset,
+        AZ::IO::GenericStream* stream) -> bool
+    {
+        auto const* const conversationAsset =
+            asset.GetAs<ConversationAsset>();
+        if (!conversationAsset || !stream)
+        {
+            return false;
+        }
+
+        auto const outcome =
+            AssetFormat::WriteConversationAsset(*conversationAsset, *stream);
+        AZ_Error( // NOLINT
+            "ConversationAssetHandler",
+            outcome.IsSuccess(),
+            "%s",
+            outcome.IsSuccess() ? "" : outcome.GetError().c_str());
+
+        return outcome.IsSuccess();
+    }
 } // namespace Conversation
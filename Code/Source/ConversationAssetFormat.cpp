@@ -0,0 +1,770 @@
+#include "Conversation/ConversationAssetFormat.h"
+
+#include "AzCore/IO/ByteContainerStream.h"
+#include "AzCore/Serialization/Utils.h"
+#include "AzCore/Utils/Utils.h"
+#include "AzCore/std/containers/unordered_map.h"
+
+#include "Conversation/ConversationAsset.h"
+
+namespace Conversation::AssetFormat
+{
+    static_assert(AZStd::is_trivially_copyable_v<FileHeader>);
+    static_assert(AZStd::is_trivially_copyable_v<DialogueRecord>);
+    static_assert(AZStd::is_trivially_copyable_v<ResponseRecord>);
+    static_assert(AZStd::is_trivially_copyable_v<StringRef>);
+    static_assert(AZStd::is_trivially_copyable_v<ConditionInstruction>);
+    static_assert(
+        AZStd::is_trivially_copyable_v<DialogueLookupTable::Slot>);
+    static_assert(sizeof(AZ::Uuid) == sizeof(AssetIdRecord::m_guid));
+
+    namespace
+    {
+        constexpr size_t SectionAlignment{ 4 };
+
+        //! Stores each distinct string once.
+        class StringTableWriter
+        {
+        public:
+            auto Add(AZStd::string_view text) -> StringRef
+            {
+                if (text.empty())
+                {
+                    return StringRef{};
+                }
+
+                StringRef const ref{ static_cast<AZ::u32>(m_data.size()),
+                                     static_cast<AZ::u32>(text.size()) };
+                auto const [iter, inserted] =
+                    m_refs.emplace(AZStd::string{ text }, ref);
+                if (inserted)
+                {
+                    m_data.append(text.data(), text.size());
+                }
+
+                return iter->second;
+            }
+
+            [[nodiscard]] auto GetData() const -> AZStd::string const&
+            {
+                return m_data;
+            }
+
+        private:
+            AZStd::string m_data;
+            AZStd::unordered_map<AZStd::string, StringRef> m_refs;
+        };
+
+        template<typename T>
+        auto AppendSection(
+            AZStd::vector<AZ::u8>& buffer, AZStd::span<T const> records)
+            -> SectionRef
+        {
+            auto const offset =
+                AZ_SIZE_ALIGN_UP(buffer.size(), SectionAlignment);
+            buffer.resize(offset + records.size_bytes());
+
+            if (!records.empty())
+            {
+                memcpy(
+                    buffer.data() + offset,
+                    records.data(),
+                    records.size_bytes());
+            }
+
+            return SectionRef{ static_cast<AZ::u32>(offset),
+                               static_cast<AZ::u32>(records.size()) };
+        }
+
+        //! Bounds-checked access to the sections of a product.
+        class ProductReader
+        {
+        public:
+            explicit ProductReader(AZStd::span<AZ::u8 const> buffer)
+                : m_buffer(buffer)
+            {
+            }
+
+            template<typename T>
+            [[nodiscard]] auto CheckSection(SectionRef section) const -> bool
+            {
+                return CheckRange(
+                    section.m_offset,
+                    static_cast<AZ::u64>(section.m_count) * sizeof(T));
+            }
+
+            //! Reads record @p index of a section checked with CheckSection.
+            template<typename T>
+            [[nodiscard]] auto ReadRecord(SectionRef section, AZ::u32 index)
+                const -> T
+            {
+                T record;
+                memcpy(
+                    &record,
+                    m_buffer.data() + section.m_offset + index * sizeof(T),
+                    sizeof(T));
+                return record;
+            }
+
+            void SetStringTable(SectionRef stringTable)
+            {
+                m_stringTable = stringTable;
+            }
+
+            void SetChunkText(SectionRef chunkText)
+            {
+                m_chunkText = chunkText;
+            }
+
+            [[nodiscard]] auto CheckString(StringRef ref) const -> bool
+            {
+                return CheckBlockString(m_stringTable, ref);
+            }
+
+            //! Returns a string checked with CheckString.
+            [[nodiscard]] auto GetString(StringRef ref) const
+                -> AZStd::string_view
+            {
+                return GetBlockString(m_stringTable, ref);
+            }
+
+            [[nodiscard]] auto CheckChunk(StringRef ref) const -> bool
+            {
+                return CheckBlockString(m_chunkText, ref);
+            }
+
+            //! Returns chunk text checked with CheckChunk.
+            [[nodiscard]] auto GetChunk(StringRef ref) const
+                -> AZStd::string_view
+            {
+                return GetBlockString(m_chunkText, ref);
+            }
+
+            [[nodiscard]] auto CheckRange(AZ::u64 offset, AZ::u64 size) const
+                -> bool
+            {
+                return offset + size <= m_buffer.size();
+            }
+
+        private:
+            [[nodiscard]] static auto CheckBlockString(
+                SectionRef block, StringRef ref) -> bool
+            {
+                return static_cast<AZ::u64>(ref.m_offset) + ref.m_size <=
+                    block.m_count;
+            }
+
+            [[nodiscard]] auto GetBlockString(
+                SectionRef block, StringRef ref) const -> AZStd::string_view
+            {
+                return AZStd::string_view{
+                    reinterpret_cast<char const*>(m_buffer.data()) +
+                        block.m_offset + ref.m_offset,
+                    ref.m_size
+                };
+            }
+
+            AZStd::span<AZ::u8 const> m_buffer;
+            //! The string table's offset and size in bytes.
+            SectionRef m_stringTable{};
+            //! The embedded chunk text block's offset and size in bytes.
+            SectionRef m_chunkText{};
+        };
+    } // namespace
+
+    auto IsBinaryProduct(AZStd::span<AZ::u8 const> buffer) -> bool
+    {
+        if (buffer.size() < sizeof(FileHeader))
+        {
+            return false;
+        }
+
+        AZ::u32 magic{};
+        memcpy(&magic, buffer.data(), sizeof(magic));
+
+        return magic == Magic;
+    }
+
+    auto WriteConversationAsset(
+        ConversationAsset const& asset,
+        AZ::IO::GenericStream& stream,
+        AZ::IO::GenericStream* chunkTextStream)
+        -> AZ::Outcome<void, AZStd::string>
+    {
+        if (asset.IsChunkTextStreamed())
+        {
+            return AZ::Failure(AZStd::string{
+                "Unable to write a conversation asset whose chunk text is "
+                "streamed, since its text isn't resident." });
+        }
+
+        StringTableWriter strings;
+        StringTableWriter chunkText;
+
+        AZStd::vector<DialogueRecord> dialogueRecords;
+        AZStd::vector<AZ::u32> responseIds;
+        AZStd::vector<ConditionInstruction> conditionCode;
+        dialogueRecords.reserve(asset.m_dialogues.size());
+
+        bool const hasAvailabilityKeys = asset.HasAvailabilityKeys();
+        for (DialogueIndex index{}; index < asset.m_dialogues.size(); ++index)
+        {
+            DialogueData const& dialogue = asset.m_dialogues[index];
+
+            DialogueRecord record{};
+            record.m_id = dialogue.GetId().GetHash();
+            record.m_availabilityId = dialogue.GetAvailabilityId().GetHash();
+            if (hasAvailabilityKeys)
+            {
+                record.m_availabilityKey =
+                    strings.Add(asset.GetAvailabilityKey(index));
+            }
+            else
+            {
+                AZ::Name const key{ record.m_availabilityId };
+                record.m_availabilityKey = strings.Add(key.GetStringView());
+            }
+
+            // Short text taken from external chunk text is taken again once
+            // the chunk is streamed in, so it isn't kept resident as well.
+            auto const shortText = dialogue.GetShortText();
+            bool const isShortTextFromChunk =
+                chunkTextStream && shortText == dialogue.GetChunkAsText();
+            record.m_shortText = strings.Add(
+                isShortTextFromChunk ? AZStd::string_view{} : shortText);
+            record.m_speaker = strings.Add(dialogue.GetSpeaker());
+            record.m_comment = strings.Add(dialogue.GetComment());
+            record.m_chunk = chunkText.Add(dialogue.GetChunkAsText());
+            record.m_audioControl =
+                strings.Add(dialogue.GetAudioControl().GetName());
+            record.m_cinematicId =
+                strings.Add(dialogue.GetCinematicId().GetStringView());
+            record.m_responseIds = SectionRef{
+                static_cast<AZ::u32>(responseIds.size()),
+                static_cast<AZ::u32>(dialogue.CountResponseIds())
+            };
+
+            for (UniqueId const& responseId : dialogue.GetResponseIds())
+            {
+                responseIds.push_back(responseId.GetHash());
+            }
+
+            auto const code = dialogue.GetCondition().GetCode();
+            record.m_condition =
+                SectionRef{ static_cast<AZ::u32>(conditionCode.size()),
+                            static_cast<AZ::u32>(code.size()) };
+            conditionCode.insert(conditionCode.end(), code.begin(), code.end());
+            record.m_entryDelay = dialogue.GetEntryDelay();
+            record.m_exitDelay = dialogue.GetExitDelay();
+            record.m_scriptIndex = dialogue.GetScriptIndex();
+            record.m_availabilityScriptIndex =
+                dialogue.GetAvailabilityScriptIndex();
+
+            dialogueRecords.push_back(record);
+        }
+
+        AZStd::vector<AZ::u32> startingIds;
+        startingIds.reserve(asset.m_startingIds.size());
+        for (UniqueId const& startingId : asset.m_startingIds)
+        {
+            startingIds.push_back(startingId.GetHash());
+        }
+
+        AZStd::vector<ResponseRecord> responses;
+        responses.reserve(asset.m_responses.size());
+        for (ResponseData const& response : asset.m_responses)
+        {
+            responses.push_back(ResponseRecord{
+                response.m_parentDialogueId.GetHash(),
+                response.m_responseDialogueId.GetHash() });
+        }
+
+        AZStd::vector<StringRef> chunks;
+        chunks.reserve(asset.m_chunks.size());
+        for (DialogueChunk const& chunk : asset.m_chunks)
+        {
+            chunks.push_back(strings.Add(chunk.GetData()));
+        }
+
+        AZStd::vector<StringRef> names;
+        names.reserve(asset.m_names.size());
+        for (AZ::Name const& name : asset.m_names)
+        {
+            names.push_back(strings.Add(name.GetStringView()));
+        }
+
+        FileHeader header{};
+        header.m_magic = Magic;
+        header.m_version = Version;
+        header.m_flags = chunkTextStream ? ExternalChunkTextFlag : 0;
+        header.m_comment = strings.Add(asset.m_comment);
+
+        auto const mainScriptId = asset.m_mainScript.GetId();
+        memcpy(
+            header.m_mainScript.m_guid,
+            &mainScriptId.m_guid,
+            sizeof(header.m_mainScript.m_guid));
+        header.m_mainScript.m_subId = mainScriptId.m_subId;
+
+        // The builder loads assets through paths that already resolve the
+        // graph, but an asset edited in memory may need it built here.
+        ConversationAsset::ResponseOffsetContainer builtOffsets;
+        ConversationAsset::ResponseIndexContainer builtIndices;
+        if (!asset.HasResponseGraph())
+        {
+            asset.BuildResponseGraph(builtOffsets, builtIndices);
+        }
+
+        auto const& responseOffsets = asset.HasResponseGraph()
+            ? asset.m_responseOffsets
+            : builtOffsets;
+        auto const& responseIndices = asset.HasResponseGraph()
+            ? asset.m_responseIndices
+            : builtIndices;
+
+        // The perfect hash is built here, by the builder, so that loading
+        // only has to verify it.
+        DialogueLookupTable builtLookup;
+        if (asset.m_dialogueLookup.IsEmpty() &&
+            !builtLookup.Build(asset.CollectDialogueIds()))
+        {
+            return AZ::Failure(AZStd::string{
+                "Unable to write a conversation asset with repeated dialogue "
+                "IDs." });
+        }
+
+        auto const& dialogueLookup = asset.m_dialogueLookup.IsEmpty()
+            ? builtLookup
+            : asset.m_dialogueLookup;
+
+        AZStd::vector<AZ::u8> buffer(sizeof(FileHeader));
+        header.m_dialogues =
+            AppendSection<DialogueRecord>(buffer, dialogueRecords);
+        header.m_responseIds = AppendSection<AZ::u32>(buffer, responseIds);
+        header.m_startingIds = AppendSection<AZ::u32>(buffer, startingIds);
+        header.m_responses = AppendSection<ResponseRecord>(buffer, responses);
+        header.m_chunks = AppendSection<StringRef>(buffer, chunks);
+        header.m_names = AppendSection<StringRef>(buffer, names);
+        header.m_responseOffsets =
+            AppendSection<AZ::u32>(buffer, responseOffsets);
+        header.m_responseIndices =
+            AppendSection<DialogueIndex>(buffer, responseIndices);
+        header.m_dialogueLookupSeeds =
+            AppendSection<AZ::u32>(buffer, dialogueLookup.GetSeeds());
+        header.m_dialogueLookupSlots = AppendSection<DialogueLookupTable::Slot>(
+            buffer, dialogueLookup.GetSlots());
+        header.m_conditionCode =
+            AppendSection<ConditionInstruction>(buffer, conditionCode);
+
+        auto const& stringData = strings.GetData();
+        header.m_stringTable = AppendSection<AZ::u8>(
+            buffer,
+            AZStd::span<AZ::u8 const>(
+                reinterpret_cast<AZ::u8 const*>(stringData.data()),
+                stringData.size()));
+
+        auto const& chunkTextData = chunkText.GetData();
+        if (chunkTextStream)
+        {
+            if (chunkTextStream->Write(
+                    chunkTextData.size(), chunkTextData.data()) !=
+                chunkTextData.size())
+            {
+                return AZ::Failure(AZStd::string{
+                    "Failed to write the conversation asset's text." });
+            }
+        }
+        else
+        {
+            header.m_chunkText = AppendSection<AZ::u8>(
+                buffer,
+                AZStd::span<AZ::u8 const>(
+                    reinterpret_cast<AZ::u8 const*>(chunkTextData.data()),
+                    chunkTextData.size()));
+        }
+
+        header.m_fileSize = static_cast<AZ::u32>(buffer.size());
+        memcpy(buffer.data(), &header, sizeof(header));
+
+        if (stream.Write(buffer.size(), buffer.data()) != buffer.size())
+        {
+            return AZ::Failure(
+                AZStd::string{ "Failed to write the conversation asset." });
+        }
+
+        return AZ::Success();
+    }
+
+    auto ReadConversationAsset(
+        AZStd::span<AZ::u8 const> buffer, ConversationAsset& asset)
+        -> AZ::Outcome<void, AZStd::string>
+    {
+        if (!IsBinaryProduct(buffer))
+        {
+            return AZ::Failure(
+                AZStd::string{ "Not a binary conversation asset." });
+        }
+
+        FileHeader header;
+        memcpy(&header, buffer.data(), sizeof(header));
+
+        if (header.m_version != Version)
+        {
+            return AZ::Failure(AZStd::string::format(
+                "Unsupported conversation asset version %u; expected %u.",
+                header.m_version,
+                Version));
+        }
+
+        if (header.m_fileSize != buffer.size())
+        {
+            return AZ::Failure(AZStd::string::format(
+                "Conversation asset is %zu bytes but its header says %u.",
+                buffer.size(),
+                header.m_fileSize));
+        }
+
+        ProductReader reader{ buffer };
+
+        bool const sectionsAreValid =
+            reader.CheckSection<AZ::u8>(header.m_stringTable) &&
+            reader.CheckSection<DialogueRecord>(header.m_dialogues) &&
+            reader.CheckSection<AZ::u32>(header.m_responseIds) &&
+            reader.CheckSection<AZ::u32>(header.m_startingIds) &&
+            reader.CheckSection<ResponseRecord>(header.m_responses) &&
+            reader.CheckSection<StringRef>(header.m_chunks) &&
+            reader.CheckSection<StringRef>(header.m_names) &&
+            reader.CheckSection<AZ::u32>(header.m_responseOffsets) &&
+            reader.CheckSection<DialogueIndex>(header.m_responseIndices) &&
+            reader.CheckSection<AZ::u8>(header.m_chunkText) &&
+            reader.CheckSection<AZ::u32>(header.m_dialogueLookupSeeds) &&
+            reader.CheckSection<DialogueLookupTable::Slot>(
+                header.m_dialogueLookupSlots) &&
+            reader.CheckSection<ConditionInstruction>(header.m_conditionCode);
+
+        if (!sectionsAreValid)
+        {
+            return AZ::Failure(AZStd::string{
+                "Conversation asset has a section outside of the file." });
+        }
+
+        reader.SetStringTable(header.m_stringTable);
+        reader.SetChunkText(header.m_chunkText);
+
+        bool const isChunkTextExternal =
+            (header.m_flags & ExternalChunkTextFlag) != 0;
+
+        if (!reader.CheckString(header.m_comment))
+        {
+            return AZ::Failure(
+                AZStd::string{ "Conversation asset comment is corrupt." });
+        }
+
+        asset.m_comment = reader.GetString(header.m_comment);
+
+        AZ::Data::AssetId mainScriptId{};
+        memcpy(
+            &mainScriptId.m_guid,
+            header.m_mainScript.m_guid,
+            sizeof(header.m_mainScript.m_guid));
+        mainScriptId.m_subId = header.m_mainScript.m_subId;
+        if (mainScriptId.IsValid())
+        {
+            asset.m_mainScript = AZ::Data::Asset<AZ::ScriptAsset>(
+                mainScriptId, azrtti_typeid<AZ::ScriptAsset>());
+        }
+
+        asset.m_dialogues.reserve(header.m_dialogues.m_count);
+        asset.m_availabilityKeyRefs.reserve(header.m_dialogues.m_count);
+        for (AZ::u32 index{}; index < header.m_dialogues.m_count; ++index)
+        {
+            auto const record =
+                reader.ReadRecord<DialogueRecord>(header.m_dialogues, index);
+
+            bool const recordIsValid =
+                reader.CheckString(record.m_availabilityKey) &&
+                reader.CheckString(record.m_shortText) &&
+                reader.CheckString(record.m_speaker) &&
+                reader.CheckString(record.m_comment) &&
+                (isChunkTextExternal || reader.CheckChunk(record.m_chunk)) &&
+                reader.CheckString(record.m_audioControl) &&
+                reader.CheckString(record.m_cinematicId) &&
+                static_cast<AZ::u64>(record.m_responseIds.m_offset) +
+                        record.m_responseIds.m_count <=
+                    header.m_responseIds.m_count &&
+                static_cast<AZ::u64>(record.m_condition.m_offset) +
+                        record.m_condition.m_count <=
+                    header.m_conditionCode.m_count;
+
+            if (!recordIsValid)
+            {
+                return AZ::Failure(AZStd::string::format(
+                    "Conversation asset dialogue %u is corrupt.", index));
+            }
+
+            DialogueData dialogue{ UniqueId::CreateFromHash(record.m_id) };
+            dialogue.SetAvailabilityId(
+                UniqueId::CreateFromHash(record.m_availabilityId));
+
+            auto const availabilityKey =
+                reader.GetString(record.m_availabilityKey);
+            asset.m_availabilityKeyRefs.push_back(StringRef{
+                static_cast<AZ::u32>(asset.m_availabilityKeyText.size()),
+                record.m_availabilityKey.m_size });
+            asset.m_availabilityKeyText.append(
+                availabilityKey.data(), availabilityKey.size());
+
+            if (isChunkTextExternal)
+            {
+                // Empty short text is filled in when the chunk is streamed in.
+                asset.m_chunkTextRefs.push_back(record.m_chunk);
+            }
+            else
+            {
+                DialogueChunk chunk{};
+                chunk.SetData(reader.GetChunk(record.m_chunk));
+                // The chunk has to be set first, since it fills in empty short
+                // text.
+                dialogue.SetChunk(chunk);
+            }
+
+            dialogue.SetShortText(reader.GetString(record.m_shortText));
+            dialogue.SetEntryDelay(record.m_entryDelay);
+            dialogue.SetExitDelay(record.m_exitDelay);
+            dialogue.SetScriptIndex(record.m_scriptIndex);
+            dialogue.SetAvailabilityScriptIndex(
+                record.m_availabilityScriptIndex);
+            dialogue.SetSpeaker(reader.GetString(record.m_speaker));
+            dialogue.SetComment(reader.GetString(record.m_comment));
+            dialogue.SetAudioControl(DialogueAudioControl{
+                reader.GetString(record.m_audioControl) });
+
+            if (record.m_cinematicId.m_size > 0)
+            {
+                dialogue.SetCinematicId(
+                    AZ::Name{ reader.GetString(record.m_cinematicId) });
+            }
+
+            for (AZ::u32 responseIndex{};
+                 responseIndex < record.m_responseIds.m_count;
+                 ++responseIndex)
+            {
+                dialogue.AddResponseId(
+                    UniqueId::CreateFromHash(reader.ReadRecord<AZ::u32>(
+                        header.m_responseIds,
+                        record.m_responseIds.m_offset + responseIndex)));
+            }
+
+            if (record.m_condition.m_count > 0)
+            {
+                AZStd::vector<ConditionInstruction> code;
+                code.reserve(record.m_condition.m_count);
+                for (AZ::u32 instruction{};
+                     instruction < record.m_condition.m_count;
+                     ++instruction)
+                {
+                    code.push_back(reader.ReadRecord<ConditionInstruction>(
+                        header.m_conditionCode,
+                        record.m_condition.m_offset + instruction));
+                }
+
+                DialogueCondition condition;
+                if (!condition.SetCode(AZStd::move(code)))
+                {
+                    return AZ::Failure(AZStd::string::format(
+                        "Conversation asset dialogue %u condition is corrupt.",
+                        index));
+                }
+
+                dialogue.SetCondition(AZStd::move(condition));
+            }
+
+            asset.m_dialogues.push_back(AZStd::move(dialogue));
+        }
+
+        asset.m_startingIds.reserve(header.m_startingIds.m_count);
+        for (AZ::u32 index{}; index < header.m_startingIds.m_count; ++index)
+        {
+            asset.m_startingIds.push_back(UniqueId::CreateFromHash(
+                reader.ReadRecord<AZ::u32>(header.m_startingIds, index)));
+        }
+
+        asset.m_responses.reserve(header.m_responses.m_count);
+        for (AZ::u32 index{}; index < header.m_responses.m_count; ++index)
+        {
+            auto const record =
+                reader.ReadRecord<ResponseRecord>(header.m_responses, index);
+            asset.m_responses.push_back(ResponseData{
+                UniqueId::CreateFromHash(record.m_parentDialogueId),
+                UniqueId::CreateFromHash(record.m_responseDialogueId) });
+        }
+
+        for (AZ::u32 index{}; index < header.m_chunks.m_count; ++index)
+        {
+            auto const ref =
+                reader.ReadRecord<StringRef>(header.m_chunks, index);
+            if (!reader.CheckString(ref))
+            {
+                return AZ::Failure(AZStd::string::format(
+                    "Conversation asset chunk %u is corrupt.", index));
+            }
+
+            DialogueChunk chunk{};
+            chunk.SetData(reader.GetString(ref));
+            asset.m_chunks.insert(AZStd::move(chunk));
+        }
+
+        for (AZ::u32 index{}; index < header.m_names.m_count; ++index)
+        {
+            auto const ref =
+                reader.ReadRecord<StringRef>(header.m_names, index);
+            if (!reader.CheckString(ref))
+            {
+                return AZ::Failure(AZStd::string::format(
+                    "Conversation asset name %u is corrupt.", index));
+            }
+
+            asset.m_names.insert(AZ::Name{ reader.GetString(ref) });
+        }
+
+        if (header.m_responseOffsets.m_count != header.m_dialogues.m_count + 1)
+        {
+            return AZ::Failure(AZStd::string{
+                "Conversation asset response graph doesn't match its "
+                "dialogues." });
+        }
+
+        asset.m_responseOffsets.reserve(header.m_responseOffsets.m_count);
+        for (AZ::u32 index{}; index < header.m_responseOffsets.m_count; ++index)
+        {
+            auto const offset =
+                reader.ReadRecord<AZ::u32>(header.m_responseOffsets, index);
+            bool const offsetIsValid =
+                offset <= header.m_responseIndices.m_count &&
+                (asset.m_responseOffsets.empty() ||
+                 offset >= asset.m_responseOffsets.back());
+
+            if (!offsetIsValid)
+            {
+                return AZ::Failure(AZStd::string::format(
+                    "Conversation asset response offset %u is corrupt.",
+                    index));
+            }
+
+            asset.m_responseOffsets.push_back(offset);
+        }
+
+        asset.m_responseIndices.reserve(header.m_responseIndices.m_count);
+        for (AZ::u32 index{}; index < header.m_responseIndices.m_count; ++index)
+        {
+            auto const responseIndex = reader.ReadRecord<DialogueIndex>(
+                header.m_responseIndices, index);
+            if (responseIndex >= header.m_dialogues.m_count)
+            {
+                return AZ::Failure(AZStd::string::format(
+                    "Conversation asset response index %u is corrupt.",
+                    index));
+            }
+
+            asset.m_responseIndices.push_back(responseIndex);
+        }
+
+        AZStd::vector<AZ::u32> lookupSeeds;
+        lookupSeeds.reserve(header.m_dialogueLookupSeeds.m_count);
+        for (AZ::u32 index{}; index < header.m_dialogueLookupSeeds.m_count;
+             ++index)
+        {
+            lookupSeeds.push_back(reader.ReadRecord<AZ::u32>(
+                header.m_dialogueLookupSeeds, index));
+        }
+
+        AZStd::vector<DialogueLookupTable::Slot> lookupSlots;
+        lookupSlots.reserve(header.m_dialogueLookupSlots.m_count);
+        for (AZ::u32 index{}; index < header.m_dialogueLookupSlots.m_count;
+             ++index)
+        {
+            lookupSlots.push_back(reader.ReadRecord<DialogueLookupTable::Slot>(
+                header.m_dialogueLookupSlots, index));
+        }
+
+        if (!asset.m_dialogueLookup.Assign(
+                AZStd::move(lookupSeeds),
+                AZStd::move(lookupSlots),
+                asset.CollectDialogueIds()))
+        {
+            return AZ::Failure(AZStd::string{
+                "Conversation asset dialogue lookup table is corrupt." });
+        }
+
+        return AZ::Success();
+    }
+
+    auto SaveConversationAssetToFile(
+        ConversationAsset const& asset,
+        AZStd::string_view filePath,
+        AZStd::string_view chunkTextFilePath)
+        -> AZ::Outcome<void, AZStd::string>
+    {
+        using BufferStream = AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>>;
+
+        AZStd::vector<AZ::u8> buffer;
+        BufferStream stream{ &buffer };
+        AZStd::vector<AZ::u8> chunkTextBuffer;
+        BufferStream chunkTextStream{ &chunkTextBuffer };
+
+        bool const isChunkTextExternal = !chunkTextFilePath.empty();
+        if (auto outcome = WriteConversationAsset(
+                asset,
+                stream,
+                isChunkTextExternal ? &chunkTextStream : nullptr);
+            !outcome.IsSuccess())
+        {
+            return outcome;
+        }
+
+        if (isChunkTextExternal)
+        {
+            if (auto outcome = AZ::Utils::WriteFile(
+                    AZStd::string_view{
+                        reinterpret_cast<char const*>(chunkTextBuffer.data()),
+                        chunkTextBuffer.size() },
+                    chunkTextFilePath);
+                !outcome.IsSuccess())
+            {
+                return outcome;
+            }
+        }
+
+        return AZ::Utils::WriteFile(
+            AZStd::string_view{ reinterpret_cast<char const*>(buffer.data()),
+                                buffer.size() },
+            filePath);
+    }
+
+    auto LoadConversationAssetFromFile(
+        AZStd::string_view filePath, ConversationAsset& asset)
+        -> AZ::Outcome<void, AZStd::string>
+    {
+        auto readOutcome =
+            AZ::Utils::ReadFile<AZStd::vector<AZ::u8>>(filePath);
+        if (!readOutcome.IsSuccess())
+        {
+            return AZ::Failure(readOutcome.TakeError());
+        }
+
+        auto const& buffer = readOutcome.GetValue();
+
+        if (IsBinaryProduct(buffer))
+        {
+            return ReadConversationAsset(buffer, asset);
+        }
+
+        bool const loaded = AZ::Utils::LoadObjectFromBufferInPlace(
+            buffer.data(), buffer.size(), asset);
+
+        return loaded ? AZ::Outcome<void, AZStd::string>(AZ::Success())
+                      : AZ::Failure(AZStd::string::format(
+                            "Failed to load '%.*s' as a conversation asset.",
+                            AZ_STRING_ARG(filePath)));
+    }
+} // namespace Conversation::AssetFormat
@@ -0,0 +1,102 @@
+#include "ConversationNotificationQueue.h"
+
+#include "AzCore/std/algorithm.h"
+
+namespace Conversation
+{
+    void ConversationNotificationQueue::Push(
+        AZ::EntityId entityId, QueuedNotification const& notification)
+    {
+        PendingEntity& pending = m_pending[entityId];
+        switch (notification.m_type)
+        {
+        case ConversationNotification::Started:
+            // A new conversation never replaces the lines of the last one.
+            pending.m_dialogueEntry = PendingEntity::NoEntry;
+            pending.m_hasEnded = false;
+            break;
+        case ConversationNotification::Dialogue:
+            // Only the latest line would have made it to the screen.
+            if (pending.m_dialogueEntry != PendingEntity::NoEntry)
+            {
+                m_entries[pending.m_dialogueEntry].m_isDropped = true;
+            }
+            pending.m_dialogueEntry = m_entries.size();
+            break;
+        case ConversationNotification::Aborted:
+        case ConversationNotification::Ended:
+            if (pending.m_hasEnded)
+            {
+                return;
+            }
+            pending.m_dialogueEntry = PendingEntity::NoEntry;
+            pending.m_hasEnded = true;
+            break;
+        }
+
+        m_entries.push_back({ entityId, notification });
+    }
+
+    void ConversationNotificationQueue::Flush()
+    {
+        m_flushing.swap(m_entries);
+        m_pending.clear();
+
+        for (m_flushPosition = 0; m_flushPosition < m_flushing.size();
+             ++m_flushPosition)
+        {
+            if (!m_flushing[m_flushPosition].m_isDropped)
+            {
+                Dispatch(m_flushing[m_flushPosition]);
+            }
+        }
+
+        m_flushing.clear();
+        m_flushPosition = 0;
+    }
+
+    void ConversationNotificationQueue::FlushEntity(AZ::EntityId entityId)
+    {
+        auto const flushFrom = [entityId](AZStd::vector<Entry>& entries,
+                                          size_t first)
+        {
+            for (size_t index{ first }; index < entries.size(); ++index)
+            {
+                if (entries[index].m_entityId == entityId &&
+                    !entries[index].m_isDropped)
+                {
+                    entries[index].m_isDropped = true;
+                    Dispatch(entries[index]);
+                }
+            }
+        };
+
+        // A flush in progress has already sent everything up to its position.
+        if (m_flushPosition < m_flushing.size())
+        {
+            flushFrom(m_flushing, m_flushPosition + 1);
+        }
+
+        m_pending.erase(entityId);
+        flushFrom(m_entries, 0);
+    }
+
+    auto ConversationNotificationQueue::CountQueued() const -> size_t
+    {
+        return AZStd::count_if(
+            m_entries.begin(),
+            m_entries.end(),
+            [](Entry const& entry)
+            {
+                return !entry.m_isDropped;
+            });
+    }
+
+    void ConversationNotificationQueue::Dispatch(Entry entry)
+    {
+        DialogueNotificationDispatchBus::Event(
+            entry.m_entityId,
+            &DialogueNotificationDispatch::DispatchNotification,
+            entry.m_notification);
+    }
+} // namespace Conversation
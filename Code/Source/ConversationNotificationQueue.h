@@ -0,0 +1,134 @@
+#pragma once
+
+#include "AzCore/Component/ComponentBus.h"
+#include "AzCore/Component/EntityId.h"
+#include "AzCore/EBus/EBus.h"
+#include "AzCore/Interface/Interface.h"
+#include "AzCore/RTTI/RTTIMacros.h"
+#include "AzCore/std/containers/fixed_vector.h"
+#include "AzCore/std/containers/unordered_map.h"
+#include "AzCore/std/containers/vector.h"
+#include "AzCore/std/limits.h"
+#include "AzCore/std/smart_ptr/shared_ptr.h"
+
+#include "Conversation/DialogueData.h"
+#include "Conversation/DialogueHandle.h"
+#include "Conversation/UniqueId.h"
+
+namespace Conversation
+{
+    //! The conversation notifications a dialogue component can hold back.
+    enum class ConversationNotification : AZ::u8
+    {
+        Started,
+        Dialogue,
+        Aborted,
+        Ended
+    };
+
+    //! A spoken dialogue and its responses, as they were when it was spoken.
+    struct SpokenDialogue
+    {
+        DialogueData m_dialogue;
+        AZStd::fixed_vector<DialogueHandle, DialogueData::MaxResponses>
+            m_responses;
+    };
+
+    struct QueuedNotification
+    {
+        ConversationNotification m_type{};
+        //! The entity that started the conversation, for Started.
+        AZ::EntityId m_initiator;
+        //! The dialogue that was spoken, for Dialogue.
+        UniqueId m_dialogueId;
+        //! For a queued Dialogue, the line as it was spoken. By the flush its
+        //! conversation may have moved on or ended.
+        AZStd::shared_ptr<SpokenDialogue const> m_spokenDialogue;
+    };
+
+    //! Lets the ConversationNotificationQueue hand notifications back.
+    class DialogueNotificationDispatch : public AZ::ComponentBus
+    {
+    public:
+        AZ_DISABLE_COPY_MOVE(DialogueNotificationDispatch); // NOLINT
+
+        DialogueNotificationDispatch() = default;
+        ~DialogueNotificationDispatch() override = default;
+
+        //! Sends the notification out on the public buses.
+        virtual void DispatchNotification(
+            QueuedNotification const& notification) = 0;
+    };
+
+    using DialogueNotificationDispatchBus =
+        AZ::EBus<DialogueNotificationDispatch>;
+
+    /**
+     * @brief Holds conversation notifications back until the next tick.
+     *
+     * Listeners then run from a flat loop instead of from inside the call
+     * that caused the notification, so calling back into a conversation
+     * doesn't nest. Notifications made redundant before the flush are
+     * dropped:
+     *
+     *  - Only the latest line of each of an entity's conversations is sent.
+     *  - An abort or end right after another abort or end is dropped.
+     *
+     * Notifications queued by listeners during a flush wait for the next
+     * one, which keeps each tick's work bounded.
+     */
+    class ConversationNotificationQueue
+    {
+    public:
+        AZ_RTTI( // NOLINT
+            ConversationNotificationQueue,
+            "{6F2C8E41-9B37-4D5A-A1E6-C04D7B3F2958}");
+        AZ_DISABLE_COPY_MOVE(ConversationNotificationQueue); // NOLINT
+
+        ConversationNotificationQueue() = default;
+        virtual ~ConversationNotificationQueue() = default;
+
+        void Push(
+            AZ::EntityId entityId, QueuedNotification const& notification);
+
+        //! Sends everything queued before this call, in the order it came.
+        void Flush();
+
+        //! Sends an entity's queued notifications now, such as before it
+        //! deactivates.
+        void FlushEntity(AZ::EntityId entityId);
+
+        [[nodiscard]] auto CountQueued() const -> size_t;
+
+    private:
+        struct Entry
+        {
+            AZ::EntityId m_entityId;
+            QueuedNotification m_notification;
+            bool m_isDropped{};
+        };
+
+        //! What an entity has queued since the last flush.
+        struct PendingEntity
+        {
+            static constexpr size_t NoEntry{
+                AZStd::numeric_limits<size_t>::max()
+            };
+
+            size_t m_dialogueEntry{ NoEntry };
+            bool m_hasEnded{};
+        };
+
+        //! Takes a copy, since listeners may queue more while it's sent.
+        static void Dispatch(Entry entry);
+
+        AZStd::vector<Entry> m_entries;
+        // The entries being flushed, and how far the flush has got.
+        AZStd::vector<Entry> m_flushing;
+        size_t m_flushPosition{};
+        AZStd::unordered_map<AZ::EntityId, PendingEntity> m_pending;
+    };
+
+    using ConversationNotificationQueueInterface =
+        AZ::Interface<ConversationNotificationQueue>;
+} // namespace Conversation
@@ -0,0 +1,103 @@
+#include "ConversationPreloader.h"
+
+#include "AzCore/Component/TransformBus.h"
+#include "AzCore/EBus/Results.h"
+#include "AzCore/std/algorithm.h"
+#include "LmbrCentral/Scripting/TagComponentBus.h"
+
+namespace Conversation
+{
+    void ConversationPreloader::SetRadii(
+        float interestRadius, float releaseRadius)
+    {
+        m_interestRadius = AZStd::max(interestRadius, 0.0f);
+        m_releaseRadius = AZStd::max(releaseRadius, m_interestRadius);
+    }
+
+    void ConversationPreloader::Update(float deltaTime)
+    {
+        m_timeUntilScan -= deltaTime;
+        if (m_timeUntilScan > 0.0f)
+        {
+            return;
+        }
+
+        m_timeUntilScan = ScanInterval;
+        Scan();
+    }
+
+    void ConversationPreloader::Scan()
+    {
+        auto const focus = FindFocus();
+        // Losing the focus for a moment, such as while the player respawns,
+        // shouldn't drop everything that was loaded.
+        if (!focus.IsValid())
+        {
+            return;
+        }
+
+        AZ::Vector3 focusPosition = AZ::Vector3::CreateZero();
+        AZ::TransformBus::EventResult(
+            focusPosition,
+            focus,
+            &AZ::TransformBus::Events::GetWorldTranslation);
+
+        auto const interestRadiusSq = m_interestRadius * m_interestRadius;
+        auto const releaseRadiusSq = m_releaseRadius * m_releaseRadius;
+
+        DialoguePreloadRequestBus::EnumerateHandlers(
+            [&](DialoguePreloadRequests* speaker) -> bool
+            {
+                auto const distanceSq =
+                    speaker->GetPreloadPosition().GetDistanceSq(focusPosition);
+                if (speaker->IsPreloaded())
+                {
+                    if (distanceSq > releaseRadiusSq)
+                    {
+                        speaker->ReleasePreload();
+                    }
+                }
+                else if (distanceSq <= interestRadiusSq)
+                {
+                    speaker->Preload();
+                }
+
+                return true;
+            });
+    }
+
+    void ConversationPreloader::ReleaseAll()
+    {
+        DialoguePreloadRequestBus::EnumerateHandlers(
+            [](DialoguePreloadRequests* speaker) -> bool
+            {
+                if (speaker->IsPreloaded())
+                {
+                    speaker->ReleasePreload();
+                }
+                return true;
+            });
+    }
+
+    auto ConversationPreloader::FindFocus() const -> AZ::EntityId
+    {
+        if (m_focus.IsValid())
+        {
+            return m_focus;
+        }
+
+        if (m_player.IsValid())
+        {
+            return m_player;
+        }
+
+        // Projects that never set a player still tag it.
+        AZ::EBusAggregateResults<AZ::EntityId> players;
+        LmbrCentral::TagGlobalRequestBus::EventResult(
+            players,
+            AZ_CRC_CE("player"),
+            &LmbrCentral::TagGlobalRequests::RequestTaggedEntities);
+        return players.values.empty() ? AZ::EntityId{}
+                                      : players.values.front();
+    }
+} // namespace Conversation
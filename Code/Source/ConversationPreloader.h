@@ -0,0 +1,96 @@
+#pragma once
+
+#include "AzCore/Component/ComponentBus.h"
+#include "AzCore/Component/EntityId.h"
+#include "AzCore/EBus/EBus.h"
+#include "AzCore/Math/Vector3.h"
+
+namespace Conversation
+{
+    /**
+     * @brief Lets the ConversationPreloader warm up an entity's conversation.
+     *
+     * Implemented by dialogue components. Whatever Preload() starts loading
+     * is held until ReleasePreload(), or until the component deactivates.
+     */
+    class DialoguePreloadRequests : public AZ::ComponentBus
+    {
+    public:
+        AZ_DISABLE_COPY_MOVE(DialoguePreloadRequests); // NOLINT
+
+        DialoguePreloadRequests() = default;
+        ~DialoguePreloadRequests() override = default;
+
+        [[nodiscard]] virtual auto GetPreloadPosition() const
+            -> AZ::Vector3 = 0;
+        [[nodiscard]] virtual auto IsPreloaded() const -> bool = 0;
+
+        //! Queues asynchronous loads of what a conversation starts with.
+        virtual void Preload() = 0;
+        virtual void ReleasePreload() = 0;
+    };
+
+    using DialoguePreloadRequestBus = AZ::EBus<DialoguePreloadRequests>;
+
+    /**
+     * @brief Preloads the conversations of speakers near the player.
+     *
+     * Speakers are preloaded once they come within the interest radius of the
+     * focus entity, and released once they are beyond the release radius.
+     * The gap between the two keeps a speaker at the edge from being loaded
+     * and released over and over.
+     *
+     * Unless a focus is set, the player is used. If no player was set
+     * either, the entity tagged "player" is looked for.
+     */
+    class ConversationPreloader
+    {
+    public:
+        static constexpr float DefaultInterestRadius{ 15.0f };
+        static constexpr float DefaultReleaseRadius{ 20.0f };
+        //! Speakers are checked this often, in seconds, instead of every tick.
+        static constexpr float ScanInterval{ 0.25f };
+
+        //! The release radius is raised to the interest radius if it's less.
+        void SetRadii(float interestRadius, float releaseRadius);
+
+        [[nodiscard]] auto GetInterestRadius() const -> float
+        {
+            return m_interestRadius;
+        }
+
+        [[nodiscard]] auto GetReleaseRadius() const -> float
+        {
+            return m_releaseRadius;
+        }
+
+        //! An invalid entity goes back to following the player.
+        void SetFocus(AZ::EntityId focus)
+        {
+            m_focus = focus;
+        }
+
+        //! An invalid entity goes back to looking for the "player" tag.
+        void SetPlayer(AZ::EntityId player)
+        {
+            m_player = player;
+        }
+
+        void Update(float deltaTime);
+
+        //! Checks every speaker against the focus's current position.
+        void Scan();
+
+        //! Releases every preloaded speaker.
+        void ReleaseAll();
+
+    private:
+        [[nodiscard]] auto FindFocus() const -> AZ::EntityId;
+
+        AZ::EntityId m_focus;
+        AZ::EntityId m_player;
+        float m_interestRadius{ DefaultInterestRadius };
+        float m_releaseRadius{ DefaultReleaseRadius };
+        float m_timeUntilScan{};
+    };
+} // namespace Conversation
@@ -0,0 +1,112 @@
+#include "ConversationSession.h"
+
+#include "AzCore/Debug/Trace.h"
+#include "AzCore/std/algorithm.h"
+
+#include "Conversation/ConversationAsset.h"
+#include "Conversation/DialogueChunk.h"
+
+namespace Conversation
+{
+    void ConversationSession::Reset()
+    {
+        AZ_Assert( // NOLINT
+            m_heldText.empty(),
+            "Held text must be released before the session is reset.");
+        AZ_Assert( // NOLINT
+            m_speculativeText.empty(),
+            "Speculative text must be released before the session is reset.");
+
+        m_owner.SetInvalid();
+        m_state = DialogueState::Inactive;
+        m_hasActiveDialogue = false;
+        m_responses.clear();
+        ClearDelayedStep();
+        StopSpeculation();
+        // Any load still in flight is for a conversation that has ended.
+        ++m_textLoadSerial;
+    }
+
+    void ConversationSession::SetActiveDialogue(DialogueData const& dialogue)
+    {
+        m_activeDialogue = dialogue;
+        m_hasActiveDialogue = true;
+    }
+
+    void ConversationSession::SetActiveChunk(DialogueChunk const& chunk)
+    {
+        m_activeDialogue.SetChunk(chunk);
+    }
+
+    auto ConversationSession::RestartSpeculation(AZ::u64 epoch) -> AZ::u32
+    {
+        StopSpeculation();
+        m_speculationEpoch = epoch;
+        return m_speculationSerial;
+    }
+
+    void ConversationSession::StopSpeculation()
+    {
+        m_speculativeSteps.clear();
+        ++m_speculationSerial;
+    }
+
+    void ConversationSession::AddSpeculativeStep(
+        UniqueId const& dialogueId, ResponseHandles const& responses)
+    {
+        if (m_speculativeSteps.size() < m_speculativeSteps.capacity())
+        {
+            m_speculativeSteps.push_back({ dialogueId, responses });
+        }
+    }
+
+    auto ConversationSession::FindSpeculativeResponses(
+        UniqueId const& dialogueId, AZ::u64 epoch) const
+        -> ResponseHandles const*
+    {
+        if (epoch != m_speculationEpoch)
+        {
+            return nullptr;
+        }
+
+        auto const iter = AZStd::find_if(
+            m_speculativeSteps.begin(),
+            m_speculativeSteps.end(),
+            [&dialogueId](SpeculativeStep const& step)
+            {
+                return step.m_dialogueId == dialogueId;
+            });
+        return iter != m_speculativeSteps.end() ? &iter->m_responses : nullptr;
+    }
+
+    auto ConversationSession::CopyResponses()
+        -> AZStd::vector<DialogueData> const&
+    {
+        m_responseCopies.resize(m_responses.size());
+        for (size_t index{}; index < m_responses.size(); ++index)
+        {
+            CopyDialogue(m_responses[index], m_responseCopies[index]);
+        }
+
+        return m_responseCopies;
+    }
+
+    void ConversationSession::CopyDialogue(
+        DialogueHandle const& handle, DialogueData& out)
+    {
+        auto const* const dialogue = handle.GetDialogue();
+        if (!dialogue)
+        {
+            out = DialogueData{};
+            return;
+        }
+
+        out = *dialogue;
+        if (handle.GetAsset()->IsChunkTextStreamed())
+        {
+            DialogueChunk chunk;
+            chunk.SetData(handle.GetChunkText());
+            out.SetChunk(chunk);
+        }
+    }
+} // namespace Conversation
@@ -0,0 +1,246 @@
+#pragma once
+
+#include "AzCore/Component/EntityId.h"
+#include "AzCore/std/containers/fixed_vector.h"
+#include "AzCore/std/containers/span.h"
+#include "AzCore/std/containers/vector.h"
+#include "AzCore/std/smart_ptr/shared_ptr.h"
+
+#include "Conversation/ChunkTextStore.h"
+#include "Conversation/DialogueComponentBus.h"
+#include "Conversation/DialogueData.h"
+#include "Conversation/DialogueHandle.h"
+#include "TimerWheel.h"
+
+namespace Conversation
+{
+    /**
+     * @brief The runtime state of one conversation.
+     *
+     * Everything a conversation step touches is either stored inline, with a
+     * fixed capacity, or kept in buffers that are reused from step to step.
+     * Once a conversation has warmed up, selecting a dialogue doesn't allocate
+     * unless the dialogue is larger than any that came before it.
+     *
+     * Responses are kept as handles into their assets. They're only copied
+     * out when something asks for DialogueData.
+     *
+     * Sessions live in the ConversationSessionPool, not in the components
+     * taking part in them.
+     */
+    class ConversationSession
+    {
+    public:
+        using ResponseHandles =
+            AZStd::fixed_vector<DialogueHandle, DialogueData::MaxResponses>;
+
+        //! The active dialogue plus each of its responses.
+        static constexpr size_t MaxHeldDialogues{
+            DialogueData::MaxResponses + 1
+        };
+
+        //! Streamed text held from one asset's text store.
+        struct HeldText
+        {
+            AZStd::shared_ptr<ChunkTextStore> m_store;
+            AZStd::fixed_vector<DialogueIndex, MaxHeldDialogues> m_indices;
+        };
+
+        using HeldTextContainer =
+            AZStd::fixed_vector<HeldText, MaxHeldDialogues>;
+
+        //! The available responses of a dialogue that may be selected next.
+        struct SpeculativeStep
+        {
+            UniqueId m_dialogueId;
+            ResponseHandles m_responses;
+        };
+
+        //! A step of the conversation that waits on a dialogue's delay.
+        enum class DelayedStep : AZ::u8
+        {
+            None,
+            //! Speak the active dialogue once its entry delay is over.
+            Speak,
+            //! Continue the conversation once the exit delay is over.
+            Continue
+        };
+
+        /**
+         * @brief Returns the session to the inactive state.
+         *
+         * Buffers keep their capacity, so the next conversation doesn't have
+         * to grow them again. Held text must be released beforehand.
+         */
+        void Reset();
+
+        //! Returns the entity whose conversation this is.
+        [[nodiscard]] auto GetOwner() const -> AZ::EntityId
+        {
+            return m_owner;
+        }
+
+        void SetOwner(AZ::EntityId owner)
+        {
+            m_owner = owner;
+        }
+
+        [[nodiscard]] auto GetState() const -> DialogueState
+        {
+            return m_state;
+        }
+
+        void SetState(DialogueState state)
+        {
+            m_state = state;
+        }
+
+        [[nodiscard]] auto HasActiveDialogue() const -> bool
+        {
+            return m_hasActiveDialogue;
+        }
+
+        //! Only valid while HasActiveDialogue() is true.
+        [[nodiscard]] auto GetActiveDialogue() const -> DialogueData const&
+        {
+            return m_activeDialogue;
+        }
+
+        //! Copies the dialogue into the session's reusable buffer.
+        void SetActiveDialogue(DialogueData const& dialogue);
+        void SetActiveChunk(DialogueChunk const& chunk);
+
+        [[nodiscard]] auto GetResponses() const
+            -> AZStd::span<DialogueHandle const>
+        {
+            return m_responses;
+        }
+
+        [[nodiscard]] auto HasResponses() const -> bool
+        {
+            return !m_responses.empty();
+        }
+
+        void SetResponses(ResponseHandles const& responses)
+        {
+            m_responses = responses;
+        }
+
+        /**
+         * @brief Copies the responses out, reusing the previous step's copies.
+         *
+         * Text an asset streams in is filled in, as long as it is loaded.
+         */
+        [[nodiscard]] auto CopyResponses()
+            -> AZStd::vector<DialogueData> const&;
+
+        [[nodiscard]] auto GetDelayedStep() const -> DelayedStep
+        {
+            return m_delayedStep;
+        }
+
+        //! Returns the timer the delayed step waits on.
+        [[nodiscard]] auto GetDelayTimer() const -> TimerWheel::Handle
+        {
+            return m_delayTimer;
+        }
+
+        void SetDelayedStep(DelayedStep step, TimerWheel::Handle timer)
+        {
+            m_delayedStep = step;
+            m_delayTimer = timer;
+        }
+
+        void ClearDelayedStep()
+        {
+            SetDelayedStep(DelayedStep::None, {});
+        }
+
+        /**
+         * @brief Drops the steps worked out so far and starts over.
+         *
+         * Any speculation still in flight becomes stale. Steps are only used
+         * while the world state epoch is the one given here.
+         *
+         * @returns The serial identifying the new speculation.
+         */
+        auto RestartSpeculation(AZ::u64 epoch) -> AZ::u32;
+        //! Drops the steps worked out so far, without starting over.
+        void StopSpeculation();
+
+        [[nodiscard]] auto GetSpeculationSerial() const -> AZ::u32
+        {
+            return m_speculationSerial;
+        }
+
+        void AddSpeculativeStep(
+            UniqueId const& dialogueId, ResponseHandles const& responses);
+
+        /**
+         * @brief Returns the responses worked out ahead for a dialogue.
+         *
+         * @returns nullptr if there are none, or the world state has changed
+         * since they were worked out.
+         */
+        [[nodiscard]] auto FindSpeculativeResponses(
+            UniqueId const& dialogueId, AZ::u64 epoch) const
+            -> ResponseHandles const*;
+
+        //! Streamed text held for the dialogues that may be selected next.
+        [[nodiscard]] auto GetSpeculativeText() -> AZStd::vector<HeldText>&
+        {
+            return m_speculativeText;
+        }
+
+        //! Moves the speculative text out, so the caller can release it.
+        [[nodiscard]] auto TakeSpeculativeText() -> AZStd::vector<HeldText>
+        {
+            return AZStd::move(m_speculativeText);
+        }
+
+        [[nodiscard]] auto GetHeldText() -> HeldTextContainer&
+        {
+            return m_heldText;
+        }
+
+        [[nodiscard]] auto GetTextLoadSerial() const -> AZ::u32
+        {
+            return m_textLoadSerial;
+        }
+
+        //! Starts a new text load, which makes any load in flight stale.
+        auto NextTextLoadSerial() -> AZ::u32
+        {
+            return ++m_textLoadSerial;
+        }
+
+        /**
+         * @brief Copies a dialogue out of its asset, into an existing object.
+         *
+         * Assigning over an existing dialogue reuses its buffers.
+         */
+        static void CopyDialogue(
+            DialogueHandle const& handle, DialogueData& out);
+
+    private:
+        AZ::EntityId m_owner;
+        DialogueState m_state{ DialogueState::Inactive };
+        bool m_hasActiveDialogue{};
+        DialogueData m_activeDialogue;
+        ResponseHandles m_responses;
+        // Copies of m_responses, handed out by CopyResponses().
+        AZStd::vector<DialogueData> m_responseCopies;
+        // Streamed text held for the active dialogue and its responses.
+        HeldTextContainer m_heldText;
+        // Identifies the latest text load, so stale ones are ignored.
+        AZ::u32 m_textLoadSerial{};
+        DelayedStep m_delayedStep{ DelayedStep::None };
+        TimerWheel::Handle m_delayTimer;
+        AZStd::fixed_vector<SpeculativeStep, DialogueData::MaxResponses>
+            m_speculativeSteps;
+        AZStd::vector<HeldText> m_speculativeText;
+        AZ::u64 m_speculationEpoch{};
+        // Identifies the latest speculation, so stale ones stop.
+        AZ::u32 m_speculationSerial{};
+    };
+} // namespace Conversation
@@ -0,0 +1,97 @@
+#include "ConversationSessionPool.h"
+
+#include "AzCore/Debug/Trace.h"
+#include "AzCore/Module/Environment.h"
+
+namespace Conversation
+{
+    namespace
+    {
+        constexpr auto SessionPoolEnvironmentName = "ConversationSessionPool";
+    } // namespace
+
+    auto ConversationSessionPool::Get() -> ConversationSessionPool&
+    {
+        static AZ::EnvironmentVariable<ConversationSessionPool> pool =
+            AZ::Environment::CreateVariable<ConversationSessionPool>(
+                SessionPoolEnvironmentName);
+        return *pool;
+    }
+
+    auto ConversationSessionPool::Acquire(AZ::EntityId owner)
+        -> ConversationSessionHandle
+    {
+        if (m_freeSlots.empty())
+        {
+            auto const firstIndex =
+                static_cast<AZ::u32>(m_pages.size() * SessionsPerPage);
+            m_pages.push_back(AZStd::make_unique<Page>());
+
+            // Slots are handed out lowest first, which keeps the sessions in
+            // use packed towards the start of the pool.
+            for (AZ::u32 offset{ SessionsPerPage }; offset > 0; --offset)
+            {
+                m_freeSlots.push_back(firstIndex + offset - 1);
+            }
+        }
+
+        auto const index = m_freeSlots.back();
+        m_freeSlots.pop_back();
+
+        Slot& slot = m_pages[index / SessionsPerPage]
+                         ->m_slots[index % SessionsPerPage];
+        slot.m_isUsed = true;
+        slot.m_session.SetOwner(owner);
+        ++m_sessionCount;
+
+        return ConversationSessionHandle{ index, slot.m_generation };
+    }
+
+    void ConversationSessionPool::Release(ConversationSessionHandle handle)
+    {
+        Slot* const slot = FindSlot(handle);
+        if (!slot)
+        {
+            AZ_Warning( // NOLINT
+                "ConversationSessionPool",
+                !handle.IsValid(),
+                "Tried to release a conversation session twice.");
+            return;
+        }
+
+        slot->m_session.Reset();
+        slot->m_isUsed = false;
+        ++slot->m_generation;
+        m_freeSlots.push_back(handle.m_index);
+        --m_sessionCount;
+    }
+
+    auto ConversationSessionPool::Find(ConversationSessionHandle handle)
+        -> ConversationSession*
+    {
+        Slot* const slot = FindSlot(handle);
+        return slot ? &slot->m_session : nullptr;
+    }
+
+    auto ConversationSessionPool::Find(ConversationSessionHandle handle) const
+        -> ConversationSession const*
+    {
+        Slot const* const slot = FindSlot(handle);
+        return slot ? &slot->m_session : nullptr;
+    }
+
+    auto ConversationSessionPool::FindSlot(
+        ConversationSessionHandle handle) const -> Slot*
+    {
+        auto const page = handle.m_index / SessionsPerPage;
+        if (!handle.IsValid() || page >= m_pages.size())
+        {
+            return nullptr;
+        }
+
+        Slot& slot = m_pages[page]->m_slots[handle.m_index % SessionsPerPage];
+        return slot.m_isUsed && slot.m_generation == handle.m_generation
+            ? &slot
+            : nullptr;
+    }
+} // namespace Conversation
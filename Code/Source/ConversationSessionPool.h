@@ -0,0 +1,110 @@
+#pragma once
+
+#include "AzCore/Component/EntityId.h"
+#include "AzCore/std/containers/array.h"
+#include "AzCore/std/containers/vector.h"
+#include "AzCore/std/limits.h"
+#include "AzCore/std/smart_ptr/unique_ptr.h"
+
+#include "ConversationSession.h"
+
+namespace Conversation
+{
+    /**
+     * @brief Refers to a session in the ConversationSessionPool.
+     *
+     * A handle goes stale once its session is released, even if the slot is
+     * reused, so holding on to one is always safe.
+     */
+    struct ConversationSessionHandle
+    {
+        static constexpr AZ::u32 InvalidIndex{
+            AZStd::numeric_limits<AZ::u32>::max()
+        };
+
+        [[nodiscard]] auto IsValid() const -> bool
+        {
+            return m_index != InvalidIndex;
+        }
+
+        AZ::u32 m_index{ InvalidIndex };
+        AZ::u32 m_generation{};
+    };
+
+    /**
+     * @brief Owns the state of every conversation in progress.
+     *
+     * Sessions are stored in fixed-size pages, so they are mostly contiguous
+     * and never move once acquired. Components refer to their session by
+     * handle, which lets systems update every conversation in one pass over
+     * the pool instead of visiting each entity.
+     *
+     * The pool is only used from the main thread.
+     */
+    class ConversationSessionPool
+    {
+    public:
+        static constexpr size_t SessionsPerPage{ 64 };
+
+        //! Returns the pool shared by every module in the process.
+        static auto Get() -> ConversationSessionPool&;
+
+        //! Returns a session in the inactive state, owned by the entity.
+        auto Acquire(AZ::EntityId owner) -> ConversationSessionHandle;
+        //! Resets the session and makes its handle stale.
+        void Release(ConversationSessionHandle handle);
+
+        //! Returns nullptr if the handle is stale or invalid.
+        [[nodiscard]] auto Find(ConversationSessionHandle handle)
+            -> ConversationSession*;
+        [[nodiscard]] auto Find(ConversationSessionHandle handle) const
+            -> ConversationSession const*;
+
+        [[nodiscard]] auto CountSessions() const -> size_t
+        {
+            return m_sessionCount;
+        }
+
+        /**
+         * @brief Calls the visitor with every acquired session, in storage
+         *        order.
+         *
+         * Sessions may not be acquired or released while visiting.
+         */
+        template<typename Visitor>
+        void ForEachSession(Visitor&& visitor)
+        {
+            for (auto const& page : m_pages)
+            {
+                for (Slot& slot : page->m_slots)
+                {
+                    if (slot.m_isUsed)
+                    {
+                        visitor(slot.m_session);
+                    }
+                }
+            }
+        }
+
+    private:
+        struct Slot
+        {
+            ConversationSession m_session;
+            AZ::u32 m_generation{};
+            bool m_isUsed{};
+        };
+
+        struct Page
+        {
+            AZStd::array<Slot, SessionsPerPage> m_slots;
+        };
+
+        [[nodiscard]] auto FindSlot(ConversationSessionHandle handle) const
+            -> Slot*;
+
+        AZStd::vector<AZStd::unique_ptr<Page>> m_pages;
+        //! Released slots, reused before a new page is added.
+        AZStd::vector<AZ::u32> m_freeSlots;
+        size_t m_sessionCount{};
+    };
+} // namespace Conversation
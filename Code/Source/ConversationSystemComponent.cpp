@@ -1,10 +1,15 @@
 #include "ConversationSystemComponent.h"
 
+#include "AzCore/Jobs/JobCompletion.h"
+#include "AzCore/Jobs/JobContext.h"
+#include "AzCore/Jobs/JobFunction.h"
 #include "AzCore/Memory/SystemAllocator.h"
 #include "AzCore/RTTI/BehaviorContext.h"
 #include "AzCore/Serialization/EditContext.h"
 #include "AzCore/Serialization/EditContextConstants.inl"
 #include "AzCore/Serialization/SerializeContext.h"
+#include "AzCore/std/algorithm.h"
+#include "AzCore/std/math.h"
 
 #include "Conversation/AvailabilityBus.h"
 #include "Conversation/Constants.h"
@@ -18,6 +23,49 @@
 
 namespace Conversation
 {
+    namespace
+    {
+        constexpr float DialogueTimerTicksPerSecond{ 1000.0f };
+        // Fewer speakers than this aren't worth handing to the job system.
+        constexpr size_t SpeakersPerJob{ 32 };
+
+        //! Where the search for one entity's starting dialogue stands.
+        struct SpeakerCheck
+        {
+            AZ::EntityId m_entityId;
+            //! The next starting dialogue to check, or the available one.
+            size_t m_next{};
+            size_t m_end{};
+            bool m_isAvailable{};
+        };
+
+        /**
+         * Walks a speaker's starting dialogues for as long as their conditions
+         * are native. It stops at the first available dialogue, or at the
+         * first one that has to ask availability handlers.
+         */
+        void CheckNativeConditions(
+            SpeakerCheck& check, AZStd::span<DialogueView const> dialogues)
+        {
+            auto const* const facts = ConditionFactsInterface::Get();
+            for (; check.m_next < check.m_end; ++check.m_next)
+            {
+                auto const& condition =
+                    dialogues[check.m_next].GetDialogue().GetCondition();
+                if (condition.IsEmpty())
+                {
+                    return;
+                }
+
+                if (condition.Evaluate(facts))
+                {
+                    check.m_isAvailable = true;
+                    return;
+                }
+            }
+        }
+    } // namespace
+
     class BehaviorDialogueScriptRequestBusHandler
         : public DialogueScriptRequestBus::Handler
         , public AZ::BehaviorEBusHandler
@@ -27,12 +75,18 @@ namespace Conversation
             BehaviorDialogueScriptRequestBusHandler,
             "{168DA145-68E2-4D49-BCE7-3BAE5589C3D1}",
             AZ::SystemAllocator,
-            RunDialogueScript);
+            RunDialogueScript,
+            RunDialogueScriptByIndex);
 
         void RunDialogueScript(AZ::Name nodeId) override
         {
             Call(FN_RunDialogueScript, nodeId);
         }
+
+        void RunDialogueScriptByIndex(AZ::u32 scriptIndex) override
+        {
+            Call(FN_RunDialogueScriptByIndex, scriptIndex);
+        }
     };
 
     void ReflectUniqueId(AZ::ReflectContext* context)
@@ -65,12 +119,28 @@ namespace Conversation
         }
     }
 
+    /**
+     * Only a chunk's data is serialized, so its hash is recomputed after it
+     * has been read in.
+     */
+    class DialogueChunkSerializationEvents
+        : public AZ::SerializeContext::IEventHandler
+    {
+    public:
+        void OnReadEnd(void* classPtr) override
+        {
+            static_cast<DialogueChunk*>(classPtr)->UpdateHash();
+        }
+    };
+
     void ReflectDialogueChunk(AZ::ReflectContext* context)
     {
         if (auto* serialize = azrtti_cast<AZ::SerializeContext*>(context))
         {
-            serialize->Class<DialogueChunk>()->Version(2)->Field(
-                "Data", &DialogueChunk::m_data);
+            serialize->Class<DialogueChunk>()
+                ->Version(2)
+                ->EventHandler<DialogueChunkSerializationEvents>()
+                ->Field("Data", &DialogueChunk::m_data);
 
             if (AZ::EditContext* editContext = serialize->GetEditContext())
             {
@@ -80,7 +150,10 @@ namespace Conversation
                         AZ::Edit::UIHandlers::MultiLineEdit,
                         &DialogueChunk::m_data,
                         "Chunk",
-                        "");
+                        "")
+                    ->Attribute(
+                        AZ::Edit::Attributes::ChangeNotify,
+                        &DialogueChunk::UpdateHash);
             }
         }
 
@@ -154,7 +227,41 @@ namespace Conversation
                 ->Attribute(
                     AZ::Script::Attributes::Scope,
                     AZ::Script::Attributes::ScopeFlags::Common)
-                ->Attribute(AZ::Script::Attributes::ConstructibleFromNil, true);
+                ->Attribute(AZ::Script::Attributes::ConstructibleFromNil, true)
+                ->Event(
+                    "BumpWorldStateEpoch",
+                    &ConversationRequestBus::Events::BumpWorldStateEpoch)
+                ->Event(
+                    "GetWorldStateEpoch",
+                    &ConversationRequestBus::Events::GetWorldStateEpoch)
+                ->Event("SetFact", &ConversationRequestBus::Events::SetFact)
+                ->Event("GetFact", &ConversationRequestBus::Events::GetFact)
+                ->Event(
+                    "SetPlayerEntity",
+                    &ConversationRequestBus::Events::SetPlayerEntity)
+                ->Event(
+                    "GetPlayerEntity",
+                    &ConversationRequestBus::Events::GetPlayerEntity)
+                ->Event(
+                    "SetPreloadRadii",
+                    &ConversationRequestBus::Events::SetPreloadRadii,
+                    { { { "InterestRadius",
+                          "Speakers closer than this are preloaded." },
+                        { "ReleaseRadius",
+                          "Preloaded speakers further than this are "
+                          "released." } } })
+                ->Event(
+                    "SetPreloadFocus",
+                    &ConversationRequestBus::Events::SetPreloadFocus)
+                ->Event(
+                    "IsInConversation",
+                    &ConversationRequestBus::Events::IsInConversation)
+                ->Event(
+                    "IsInPlayerConversation",
+                    &ConversationRequestBus::Events::IsInPlayerConversation)
+                ->Event(
+                    "CountActiveConversations",
+                    &ConversationRequestBus::Events::CountActiveConversations);
 
             behaviorContext
                 ->EBus<AvailabilityRequestBus>("AvailabilityRequestBus")
@@ -213,10 +320,20 @@ namespace Conversation
         {
             ConversationInterface::Register(this);
         }
+
+        if (ConditionFactsInterface::Get() == nullptr)
+        {
+            ConditionFactsInterface::Register(this);
+        }
     }
 
     ConversationSystemComponent::~ConversationSystemComponent()
     {
+        if (ConditionFactsInterface::Get() == this)
+        {
+            ConditionFactsInterface::Unregister(this);
+        }
+
         if (ConversationInterface::Get() == this)
         {
             ConversationInterface::Unregister(this);
@@ -259,6 +376,19 @@ namespace Conversation
 
         ConversationRequestBus::Handler::BusConnect();
         AZ::TickBus::Handler::BusConnect();
+
+        // Timers only run while we tick, so the scheduler is only offered
+        // while we're active. Without it, delays are skipped.
+        if (DialogueSchedulerInterface::Get() == nullptr)
+        {
+            DialogueSchedulerInterface::Register(this);
+        }
+
+        if (ConversationNotificationQueueInterface::Get() == nullptr)
+        {
+            ConversationNotificationQueueInterface::Register(
+                &m_notificationQueue);
+        }
     }
 
     void ConversationSystemComponent::Deactivate()
@@ -269,13 +399,258 @@ namespace Conversation
             m_conversationAssetHandler->Unregister();
         }
 
+        if (DialogueSchedulerInterface::Get() == this)
+        {
+            DialogueSchedulerInterface::Unregister(this);
+        }
+
+        // Nothing flushes the queue once we're gone.
+        if (ConversationNotificationQueueInterface::Get() ==
+            &m_notificationQueue)
+        {
+            ConversationNotificationQueueInterface::Unregister(
+                &m_notificationQueue);
+        }
+        m_notificationQueue.Flush();
+
+        m_preloader.ReleaseAll();
+        m_activeConversations.Clear();
+
         AZ::TickBus::Handler::BusDisconnect();
         ConversationRequestBus::Handler::BusDisconnect();
     }
 
+    void ConversationSystemComponent::BumpWorldStateEpoch()
+    {
+        ++m_worldStateEpoch;
+    }
+
+    auto ConversationSystemComponent::GetWorldStateEpoch() const -> AZ::u64
+    {
+        return m_worldStateEpoch;
+    }
+
+    void ConversationSystemComponent::SetFact(
+        AZStd::string_view name, AZ::s64 value)
+    {
+        auto const [iter, isNew] = m_facts.try_emplace(AZ::Crc32(name), value);
+        if (!isNew && iter->second == value)
+        {
+            return;
+        }
+
+        iter->second = value;
+        BumpWorldStateEpoch();
+    }
+
+    auto ConversationSystemComponent::GetFact(AZStd::string_view name) const
+        -> AZ::s64
+    {
+        return GetFact(static_cast<AZ::u32>(AZ::Crc32(name)));
+    }
+
+    auto ConversationSystemComponent::GetFact(AZ::u32 factId) const
+        -> ConditionValue
+    {
+        auto const iter = m_facts.find(factId);
+        return iter != m_facts.end() ? iter->second : 0;
+    }
+
+    void ConversationSystemComponent::SetPlayerEntity(AZ::EntityId player)
+    {
+        m_playerEntity = player;
+        m_preloader.SetPlayer(player);
+    }
+
+    auto ConversationSystemComponent::GetPlayerEntity() const -> AZ::EntityId
+    {
+        return m_playerEntity;
+    }
+
+    void ConversationSystemComponent::SetPreloadRadii(
+        float interestRadius, float releaseRadius)
+    {
+        m_preloader.SetRadii(interestRadius, releaseRadius);
+    }
+
+    void ConversationSystemComponent::SetPreloadFocus(AZ::EntityId focus)
+    {
+        m_preloader.SetFocus(focus);
+    }
+
+    void ConversationSystemComponent::AddActiveConversation(
+        ActiveConversation const& conversation)
+    {
+        ActiveConversation started{ conversation };
+        started.m_startTime = AZ::GetElapsedTimeMs();
+        m_activeConversations.Add(started);
+    }
+
+    void ConversationSystemComponent::RemoveActiveConversation(
+        AZ::EntityId target)
+    {
+        m_activeConversations.Remove(target);
+    }
+
+    auto ConversationSystemComponent::IsInConversation(
+        AZ::EntityId entityId) const -> bool
+    {
+        return m_activeConversations.IsInConversation(entityId);
+    }
+
+    auto ConversationSystemComponent::IsInPlayerConversation(
+        AZ::EntityId target) const -> bool
+    {
+        auto const* const conversation = m_activeConversations.Find(target);
+        return conversation && conversation->m_involvesPlayer;
+    }
+
+    auto ConversationSystemComponent::FindActiveConversation(
+        AZ::EntityId target) const -> ActiveConversation const*
+    {
+        return m_activeConversations.Find(target);
+    }
+
+    auto ConversationSystemComponent::CountActiveConversations() const
+        -> size_t
+    {
+        return m_activeConversations.CountConversations();
+    }
+
+    auto ConversationSystemComponent::FindAvailableStartingDialogues(
+        AZStd::span<AZ::EntityId const> entityIds)
+        -> AZStd::vector<AvailableStartingDialogue>
+    {
+        // Each entity is asked through its bus, so gathering stays on this
+        // thread.
+        AZStd::vector<DialogueView> dialogues;
+        AZStd::vector<SpeakerCheck> checks;
+        checks.reserve(entityIds.size());
+        for (AZ::EntityId const entityId : entityIds)
+        {
+            SpeakerCheck check{ entityId, dialogues.size() };
+            DialogueComponentRequestBus::Event(
+                entityId,
+                &DialogueComponentRequests::AppendStartingDialogues,
+                dialogues);
+            check.m_end = dialogues.size();
+            if (check.m_next != check.m_end)
+            {
+                checks.push_back(check);
+            }
+        }
+
+        // Native conditions only read facts, which can't change while we
+        // wait, so each job takes its own range of speakers.
+        auto* const jobContext = AZ::JobContext::GetGlobalContext();
+        if (!jobContext || checks.size() <= SpeakersPerJob)
+        {
+            for (SpeakerCheck& check : checks)
+            {
+                CheckNativeConditions(check, dialogues);
+            }
+        }
+        else
+        {
+            AZ::JobCompletion completion(jobContext);
+            for (size_t first{}; first < checks.size(); first += SpeakersPerJob)
+            {
+                AZStd::span<SpeakerCheck> const range{
+                    checks.data() + first,
+                    AZStd::min(SpeakersPerJob, checks.size() - first)
+                };
+                auto* const job = AZ::CreateJobFunction(
+                    [range, &dialogues]()
+                    {
+                        for (SpeakerCheck& check : range)
+                        {
+                            CheckNativeConditions(check, dialogues);
+                        }
+                    },
+                    true,
+                    jobContext);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+
+        // Whatever is left has to ask availability handlers, which are only
+        // called from the main thread.
+        AZStd::vector<AvailableStartingDialogue> results;
+        for (SpeakerCheck& check : checks)
+        {
+            while (!check.m_isAvailable && check.m_next < check.m_end)
+            {
+                DialogueComponentRequestBus::EventResult(
+                    check.m_isAvailable,
+                    check.m_entityId,
+                    &DialogueComponentRequests::CheckAvailability,
+                    dialogues[check.m_next].GetDialogue());
+                if (!check.m_isAvailable)
+                {
+                    ++check.m_next;
+                }
+            }
+
+            if (check.m_isAvailable)
+            {
+                results.push_back(
+                    { check.m_entityId, dialogues[check.m_next].GetId() });
+            }
+        }
+
+        return results;
+    }
+
+    auto ConversationSystemComponent::ScheduleSessionTimer(
+        ConversationSessionHandle session, float delaySeconds)
+        -> TimerWheel::Handle
+    {
+        auto const delay = static_cast<AZ::u64>(AZStd::ceil(
+            AZStd::max(delaySeconds, 0.0f) * DialogueTimerTicksPerSecond));
+        auto const payload = (AZ::u64{ session.m_generation } << 32U) |
+            AZ::u64{ session.m_index };
+        return m_dialogueTimers.Schedule(delay, payload);
+    }
+
+    void ConversationSystemComponent::CancelSessionTimer(
+        TimerWheel::Handle timer)
+    {
+        m_dialogueTimers.Cancel(timer);
+    }
+
     void ConversationSystemComponent::OnTick(
-        [[maybe_unused]] float deltaTime,
-        [[maybe_unused]] AZ::ScriptTimePoint time)
+        float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        m_notificationQueue.Flush();
+        m_preloader.Update(deltaTime);
+
+        m_untickedTime += deltaTime;
+        auto const ticks =
+            static_cast<AZ::u64>(m_untickedTime * DialogueTimerTicksPerSecond);
+        m_untickedTime -=
+            static_cast<float>(ticks) / DialogueTimerTicksPerSecond;
+
+        m_dialogueTimers.Advance(
+            ticks,
+            [](TimerWheel::Handle timer, AZ::u64 payload)
+            {
+                ConversationSessionHandle const sessionHandle{
+                    static_cast<AZ::u32>(payload),
+                    static_cast<AZ::u32>(payload >> 32U)
+                };
+
+                // Sessions that ended, or moved on to another step, no longer
+                // care about this timer.
+                auto const* const session =
+                    ConversationSessionPool::Get().Find(sessionHandle);
+                if (session && session->GetDelayTimer() == timer)
+                {
+                    DialogueTimerNotificationBus::Event(
+                        session->GetOwner(),
+                        &DialogueTimerNotifications::OnDelayElapsed);
+                }
+            });
     }
 } // namespace Conversation
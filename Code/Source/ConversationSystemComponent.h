@@ -2,9 +2,17 @@
 #pragma once
 
 #include "Conversation/ConversationTypeIds.h"
+#include "Conversation/DialogueCondition.h"
 #include "Conversation/DialogueData.h"
+#include "ActiveConversationRegistry.h"
+#include "ConversationNotificationQueue.h"
+#include "ConversationPreloader.h"
+#include "DialogueScheduler.h"
+#include "TimerWheel.h"
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <Conversation/ConversationAsset.h>
 #include <Conversation/ConversationBus.h>
 
@@ -13,6 +21,8 @@ namespace Conversation
     class ConversationSystemComponent
         : public AZ::Component
         , protected ConversationRequestBus::Handler
+        , public ConditionFacts
+        , public DialogueScheduler
         , public AZ::TickBus::Handler
     {
     public:
@@ -37,7 +47,44 @@ namespace Conversation
     protected:
         ////////////////////////////////////////////////////////////////////////
         // ConversationRequestBus interface implementation
+        void BumpWorldStateEpoch() override;
+        [[nodiscard]] auto GetWorldStateEpoch() const -> AZ::u64 override;
+        void SetFact(AZStd::string_view name, AZ::s64 value) override;
+        [[nodiscard]] auto GetFact(AZStd::string_view name) const
+            -> AZ::s64 override;
+        void SetPlayerEntity(AZ::EntityId player) override;
+        [[nodiscard]] auto GetPlayerEntity() const -> AZ::EntityId override;
+        void SetPreloadRadii(
+            float interestRadius, float releaseRadius) override;
+        void SetPreloadFocus(AZ::EntityId focus) override;
+        void AddActiveConversation(
+            ActiveConversation const& conversation) override;
+        void RemoveActiveConversation(AZ::EntityId target) override;
+        [[nodiscard]] auto IsInConversation(AZ::EntityId entityId) const
+            -> bool override;
+        [[nodiscard]] auto IsInPlayerConversation(AZ::EntityId target) const
+            -> bool override;
+        [[nodiscard]] auto FindActiveConversation(AZ::EntityId target) const
+            -> ActiveConversation const* override;
+        [[nodiscard]] auto CountActiveConversations() const
+            -> size_t override;
+        [[nodiscard]] auto FindAvailableStartingDialogues(
+            AZStd::span<AZ::EntityId const> entityIds)
+            -> AZStd::vector<AvailableStartingDialogue> override;
+        ////////////////////////////////////////////////////////////////////////
 
+        ////////////////////////////////////////////////////////////////////////
+        // ConditionFacts interface implementation
+        [[nodiscard]] auto GetFact(AZ::u32 factId) const
+            -> ConditionValue override;
+        ////////////////////////////////////////////////////////////////////////
+
+        ////////////////////////////////////////////////////////////////////////
+        // DialogueScheduler interface implementation
+        auto ScheduleSessionTimer(
+            ConversationSessionHandle session, float delaySeconds)
+            -> TimerWheel::Handle override;
+        void CancelSessionTimer(TimerWheel::Handle timer) override;
         ////////////////////////////////////////////////////////////////////////
 
         ////////////////////////////////////////////////////////////////////////
@@ -55,6 +102,17 @@ namespace Conversation
     private:
         AZStd::unique_ptr<ConversationAssetHandler> m_conversationAssetHandler;
         AZStd::vector<DialogueData> m_dialogues;
+        AZStd::atomic<AZ::u64> m_worldStateEpoch{};
+        // Facts by the CRC32 of their name.
+        AZStd::unordered_map<AZ::u32, ConditionValue> m_facts;
+        // Every conversation's delays, in milliseconds.
+        TimerWheel m_dialogueTimers;
+        // Time not yet advanced through m_dialogueTimers, in seconds.
+        float m_untickedTime{};
+        AZ::EntityId m_playerEntity;
+        ConversationPreloader m_preloader;
+        ConversationNotificationQueue m_notificationQueue;
+        ActiveConversationRegistry m_activeConversations;
     };
 
 } // namespace Conversation
@@ -0,0 +1,52 @@
+#include "Conversation/DialogueChunkStore.h"
+
+#include "AzCore/Module/Environment.h"
+#include "AzCore/Serialization/SerializeContext.h"
+
+#include "InternedTextSerializer.h"
+
+namespace Conversation
+{
+    namespace
+    {
+        constexpr auto DialogueChunkStoreEnvironmentName =
+            "ConversationDialogueChunkStore";
+
+        struct DialogueChunkRefText
+        {
+            using Ref = DialogueChunkRef;
+
+            static auto ToText(DialogueChunkRef const& chunkRef)
+                -> AZStd::string_view
+            {
+                return chunkRef.GetText();
+            }
+
+            static auto FromText(AZStd::string_view text) -> DialogueChunkRef
+            {
+                DialogueChunk chunk{};
+                chunk.SetData(text);
+                return DialogueChunkRef{ chunk };
+            }
+        };
+    } // namespace
+
+    auto DialogueChunkStore::Get() -> DialogueChunkStore&
+    {
+        static AZ::EnvironmentVariable<DialogueChunkStore> store =
+            AZ::Environment::CreateVariable<DialogueChunkStore>(
+                DialogueChunkStoreEnvironmentName);
+        return *store;
+    }
+
+    void DialogueChunkRef::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext =
+                azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<DialogueChunkRef>()
+                ->Version(0)
+                ->Serializer<InternedTextSerializer<DialogueChunkRefText>>();
+        }
+    }
+} // namespace Conversation
@@ -3,22 +3,31 @@
 #include "AzCore/Asset/AssetCommon.h"
 #include "AzCore/Component/Component.h"
 #include "AzCore/Component/Entity.h"
+#include "AzCore/Component/TickBus.h"
+#include "AzCore/Component/TransformBus.h"
 #include "AzCore/Debug/Trace.h"
 #include "AzCore/RTTI/BehaviorContext.h"
 #include "AzCore/RTTI/RTTIMacros.h"
 #include "AzCore/Script/ScriptContextAttributes.h"
 #include "AzCore/Serialization/SerializeContext.h"
+#include "AzCore/std/algorithm.h"
+#include "AzCore/std/containers/fixed_vector.h"
+#include "AzCore/std/parallel/atomic.h"
 #include "LmbrCentral/Audio/AudioSystemComponentBus.h"
 #include "LmbrCentral/Scripting/TagComponentBus.h"
 
+#include "IAudioSystem.h"
+
 #include "Conversation/AvailabilityBus.h"
 #include "Conversation/CinematicBus.h"
 #include "Conversation/Components/ConversationAssetRefComponentBus.h"
 #include "Conversation/Components/DialogueComponentConfig.h"
 #include "Conversation/Constants.h"
+#include "Conversation/ConversationBus.h"
 #include "Conversation/ConversationAsset.h"
 #include "Conversation/ConversationTypeIds.h"
 #include "Conversation/DialogueComponentBus.h"
+#include "Conversation/DialogueCondition.h"
 #include "Conversation/DialogueData.h"
 #include "Conversation/DialogueScript.h"
 #include "Logging.h"
@@ -33,6 +42,110 @@ namespace Conversation
     constexpr auto PlayerConversationTag{ AZ_CRC_CE("player_conversation") };
     constexpr auto PlayerSpeakerTag{ "player" };
 
+    namespace
+    {
+        /**
+         * Looks up the audio triggers of an asset's voice lines, once per
+         * asset. Controls the audio system doesn't know are reported together,
+         * instead of failing one line at a time while the game plays.
+         */
+        void ResolveAudioTriggers(
+            AZ::Data::Asset<ConversationAsset> const& asset)
+        {
+            auto* const audioSystem = AZ::Interface<Audio::IAudioSystem>::Get();
+            if (!audioSystem || !asset.IsReady() ||
+                asset->HasAudioTriggerIds())
+            {
+                return;
+            }
+
+            auto const missing = asset->ResolveAudioTriggers(
+                [audioSystem](DialogueAudioControl const& control) -> AZ::u64
+                {
+                    auto const triggerId = audioSystem->GetAudioTriggerID(
+                        control.GetName().data());
+                    return triggerId != Audio::INVALID_AUDIO_CONTROL_ID
+                        ? triggerId
+                        : ConversationAsset::NoAudioTrigger;
+                });
+            if (missing.empty())
+            {
+                return;
+            }
+
+            AZStd::string missingControls;
+            for (DialogueIndex const index : missing)
+            {
+                missingControls += "\n    ";
+                missingControls +=
+                    asset->GetDialogues()[index].GetAudioControl().GetName();
+            }
+
+            AZ_Warning( // NOLINT
+                "DialogueComponent",
+                false,
+                "Conversation asset '%s' has %zu voice lines whose audio "
+                "trigger wasn't found. They'll be looked up by name each time "
+                "they're spoken:%s",
+                asset.GetHint().c_str(),
+                missing.size(),
+                missingControls.c_str());
+        }
+
+        //! Adds a dialogue's streamed text to the text to hold, if it has any.
+        void AddStreamedText(
+            ConversationSession::HeldTextContainer& text,
+            DialogueHandle const& handle)
+        {
+            auto const* const asset = handle.GetAsset();
+            if (!asset || !asset->IsChunkTextStreamed())
+            {
+                return;
+            }
+
+            // A missing store was already reported by the asset handler.
+            auto store = asset->GetChunkTextStore();
+            if (!store)
+            {
+                return;
+            }
+
+            auto iter = AZStd::find_if(
+                text.begin(),
+                text.end(),
+                [&store](ConversationSession::HeldText const& held)
+                {
+                    return held.m_store == store;
+                });
+            if (iter == text.end())
+            {
+                if (text.size() == text.capacity())
+                {
+                    return;
+                }
+
+                iter = text.insert(
+                    text.end(),
+                    ConversationSession::HeldText{ AZStd::move(store), {} });
+            }
+
+            if (iter->m_indices.size() < iter->m_indices.capacity())
+            {
+                iter->m_indices.push_back(handle.GetIndex());
+            }
+        }
+    } // namespace
+
+    //! Combines the answers of several availability handlers.
+    struct AvailabilityMaskIntersection
+    {
+        auto operator()(AvailabilityMask lhs, AvailabilityMask rhs) const
+            -> AvailabilityMask
+        {
+            return lhs & rhs;
+        }
+    };
+
     class BehaviorDialogueComponentNotificationBusHandler
         : public DialogueComponentNotificationBus::Handler
         , public AZ::BehaviorEBusHandler
@@ -44,6 +157,10 @@ namespace Conversation
             AZ::SystemAllocator,
             GetDialogueComponentNotificationOrder,
             (),
+            OnDialogueSpoken,
+            ({ "Payload",
+               "The spoken dialogue and its available responses. Only valid "
+               "during this notification." }),
             OnDialogue,
             ({ "Dialogue", "The dialogue being that was selected/spoken." },
              { "AvailableResponses",
@@ -72,6 +189,11 @@ namespace Conversation
             return result;
         }
 
+        void OnDialogueSpoken(DialoguePayload const& payload) override
+        {
+            Call(FN_OnDialogueSpoken, payload);
+        }
+
         void OnDialogue(
             DialogueData const& dialogue,
             AZStd::vector<DialogueData> const& availableResponses) override
@@ -79,6 +201,11 @@ namespace Conversation
             Call(FN_OnDialogue, dialogue, availableResponses);
         }
 
+        [[nodiscard]] auto WantsOnDialogue() -> bool override
+        {
+            return GetEvents()[FN_OnDialogue].m_function != nullptr;
+        }
+
         void OnConversationStarted(
             const AZ::EntityId initiatingEntityId) override
         {
@@ -145,6 +272,7 @@ namespace Conversation
     {
         ConversationAsset::Reflect(context);
         DialogueComponentConfig::Reflect(context);
+        DialoguePayload::Reflect(context);
 
         auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
         if (serializeContext)
@@ -257,9 +385,29 @@ namespace Conversation
 
     void DialogueComponent::Activate()
     {
-        m_conversationAssetRequests =
-            ConversationAssetRefComponentRequestBus::FindFirstHandler(
-                GetEntityId());
+        // Every asset is merged into one index, so lookups never have to go
+        // through the bus or visit each asset. Assets that aren't ready yet
+        // are merged again once they are.
+        ConversationAssetRefComponentRequestBus::EnumerateHandlersId(
+            GetEntityId(),
+            [this](ConversationAssetRefComponentRequests* handler) -> bool
+            {
+                m_conversationAssets.push_back(handler->GetConversationAsset());
+                return true;
+            });
+        RebuildConversationIndex();
+        for (auto const& asset : m_conversationAssets)
+        {
+            if (asset.IsReady())
+            {
+                ResolveAudioTriggers(asset);
+            }
+            else if (asset.GetId().IsValid())
+            {
+                AZ::Data::AssetBus::MultiHandler::BusConnect(asset.GetId());
+            }
+        }
+        m_aliveToken = AZStd::make_shared<bool>(true);
 
         // The TagComponent is used to communicate with speakers, so we add our
         // tag to it upon activation. It will need to be removed upon
@@ -270,15 +418,33 @@ namespace Conversation
             AZ::Crc32(m_config.m_speakerTag));
 
         DialogueComponentRequestBus::Handler::BusConnect(GetEntityId());
+        DialogueTimerNotificationBus::Handler::BusConnect(GetEntityId());
+        DialoguePreloadRequestBus::Handler::BusConnect(GetEntityId());
+        DialogueNotificationDispatchBus::Handler::BusConnect(GetEntityId());
     }
 
     void DialogueComponent::Deactivate()
     {
-        m_conversationAssetRequests = nullptr; // We don't own it.
+        // Anything we held back goes out before the abort does, and the abort
+        // is sent right away since we won't be around for the next flush.
+        if (auto* const queue = ConversationNotificationQueueInterface::Get())
+        {
+            queue->FlushEntity(GetEntityId());
+        }
+        DialogueNotificationDispatchBus::Handler::BusDisconnect();
 
         // Just in case there's a conversation, we abort on deactivation.
         AbortConversation();
-
+        DialoguePreloadRequestBus::Handler::BusDisconnect();
+        ReleasePreload();
+        AZ::Data::AssetBus::MultiHandler::BusDisconnect();
+        m_conversationIndex.Clear();
+        m_conversationAssets.clear();
+        m_aliveToken.reset();
+        // Our availability handlers may be different when we come back.
+        m_availabilityCache.clear();
+
+        DialogueTimerNotificationBus::Handler::BusDisconnect();
         DialogueComponentRequestBus::Handler::BusDisconnect(GetEntityId());
 
         // We remove our speaker tag in case our component get removed.
@@ -343,7 +509,7 @@ namespace Conversation
     auto DialogueComponent::TryToStartConversation(
         AZ::EntityId initiatingEntityId) -> bool
     {
-        if (!m_conversationAssetRequests)
+        if (m_conversationAssets.empty())
         {
             AZ_Error( // NOLINT
                 "DialogueComponent",
@@ -363,7 +529,7 @@ namespace Conversation
         // Check that we have what we need to start to successfully start a
         // conversation.
 
-        if (m_currentState != DialogueState::Inactive)
+        if (GetCurrentState() != DialogueState::Inactive)
         {
             AZ_Warning( // NOLINT
                 "DialogueComponent",
@@ -375,7 +541,7 @@ namespace Conversation
             return false;
         }
 
-        if (m_conversationAssetRequests->CountDialogues() == 0)
+        if (m_conversationIndex.CountDialogues() == 0)
         {
             AZ_Warning( // NOLINT
                 "DialogueComponent",
@@ -385,7 +551,7 @@ namespace Conversation
             return false;
         }
 
-        if (m_conversationAssetRequests->CountStartingIds() == 0)
+        if (m_conversationIndex.CountStartingIds() == 0)
         {
             AZ_Warning( // NOLINT
                 "DialogueComponent",
@@ -396,7 +562,9 @@ namespace Conversation
             return false;
         }
 
-        m_currentState = DialogueState::Starting;
+        m_sessionHandle = ConversationSessionPool::Get().Acquire(GetEntityId());
+        ConversationSession& session = *FindSession();
+        session.SetState(DialogueState::Starting);
 
         AZLOG( // NOLINT
             LOG_FollowConversation,
@@ -405,24 +573,17 @@ namespace Conversation
             GetNamedEntityId().GetName().data());
 
         // We find the first available starting ID and use it to start the
-        // conversation.
-        for (UniqueId const& startingId :
-             m_conversationAssetRequests->CopyStartingIds())
-        {
-            // DialogueData and DialogueId are different types. We need to
-            // search a list of DialogueData for one matching the current
-            // DialogueId. To do so, I create a new instance of DialogueData
-            // based on the current DialogueId. DialogueData objects are always
-            // equal only if they have matching IDs. This allows me to use
-            // AZStd::find to search the container of dialogues.
-            auto const startingDialogueOutcome =
-                m_conversationAssetRequests->GetDialogueById(startingId);
+        // conversation. The starting IDs and dialogues are read in place; only
+        // the dialogue that ends up selected gets copied.
+        for (UniqueId const& startingId : m_conversationIndex.GetStartingIds())
+        {
+            DialogueView const startingDialogue =
+                m_conversationIndex.GetDialogueHandle(startingId).GetView();
 
             // Verify we found one. This should never fail, but just in case.
-            if (!startingDialogueOutcome.IsSuccess() ||
-                !startingDialogueOutcome.GetValue().IsValid())
+            if (!startingDialogue.IsValid())
             {
-                m_currentState = DialogueState::Inactive;
+                ReleaseSession();
 
                 AZ_Error( // NOLINT
                     "DialogueComponent",
@@ -432,17 +593,24 @@ namespace Conversation
                 return false;
             }
 
-            if (CheckAvailability(startingDialogueOutcome.GetValue()))
+            if (CheckAvailability(startingDialogue.GetDialogue()))
             {
-                m_currentState = DialogueState::Active;
-                LmbrCentral::TagComponentRequestBus::Event(
-                    GetEntityId(),
-                    &LmbrCentral::TagComponentRequests::AddTag,
-                    ActiveConversationTag);
+                session.SetState(DialogueState::Active);
 
                 auto const initiatingEntityIsPlayer =
                     [&initiatingEntityId]() -> bool
                 {
+                    auto const* const conversation =
+                        ConversationInterface::Get();
+                    if (auto const player = conversation
+                            ? conversation->GetPlayerEntity()
+                            : AZ::EntityId{};
+                        player.IsValid())
+                    {
+                        return initiatingEntityId == player;
+                    }
+
+                    // Projects that never set a player still tag it.
                     bool result{};
                     LmbrCentral::TagComponentRequestBus::EventResult(
                         result,
@@ -452,26 +620,18 @@ namespace Conversation
                     return result;
                 }();
 
-                if (initiatingEntityIsPlayer)
-                {
-                    LmbrCentral::TagComponentRequestBus::Event(
-                        GetEntityId(),
-                        &LmbrCentral::TagComponentRequests::AddTag,
-                        PlayerConversationTag);
-                }
+                ConversationRequestBus::Broadcast(
+                    &ConversationRequests::AddActiveConversation,
+                    ActiveConversation{ GetEntityId(),
+                                        initiatingEntityId,
+                                        initiatingEntityIsPlayer });
+                MirrorConversationTags(initiatingEntityIsPlayer);
 
-                DialogueComponentNotificationBus::Event(
-                    GetEntityId(),
-                    &DialogueComponentNotificationBus::Events::
-                        OnConversationStarted,
-                    initiatingEntityId);
-                GlobalConversationNotificationBus::Broadcast(
-                    &GlobalConversationNotificationBus::Events::
-                        OnConversationStarted,
-                    initiatingEntityId,
-                    GetEntityId());
-
-                SelectDialogue(startingDialogueOutcome.GetValue());
+                Notify({ ConversationNotification::Started,
+                         initiatingEntityId,
+                         {} });
+
+                MakeDialogueActive(startingDialogue.GetDialogue());
                 AZ_Info(
                     "DialogueComponent",
                     "A conversation was successfully started."); // NOLINT
@@ -481,7 +641,7 @@ namespace Conversation
         }
 
         // We failed to start the conversation.
-        m_currentState = DialogueState::Inactive;
+        ReleaseSession();
 
         AZ_Warning( // NOLINT
             "DialogueComponent",
@@ -494,292 +654,1315 @@ namespace Conversation
 
     void DialogueComponent::AbortConversation()
     {
-        m_currentState = DialogueState::Aborting;
-        m_activeDialogue.reset();
-        m_currentState = DialogueState::Inactive;
-
-        LmbrCentral::TagComponentRequestBus::Event(
-            GetEntityId(),
-            &LmbrCentral::TagComponentRequests::RemoveTags,
-            AZStd::unordered_set{ ActiveConversationTag,
-                                  PlayerConversationTag });
+        if (auto* const session = FindSession())
+        {
+            session->SetState(DialogueState::Aborting);
+        }
+        ReleaseSession();
+        ClearActiveConversation();
 
-        DialogueComponentNotificationBus::Event(
-            GetEntityId(),
-            &DialogueComponentNotificationBus::Events::OnConversationAborted);
-        GlobalConversationNotificationBus::Broadcast(
-            &GlobalConversationNotificationBus::Events::OnConversationAborted,
-            GetEntityId());
+        Notify({ ConversationNotification::Aborted, {}, {} });
     }
 
     void DialogueComponent::EndConversation()
     {
-        m_currentState = DialogueState::Ending;
-        m_activeDialogue.reset();
-        m_currentState = DialogueState::Inactive;
-
-        LmbrCentral::TagComponentRequestBus::Event(
-            GetEntityId(),
-            &LmbrCentral::TagComponentRequests::RemoveTags,
-            AZStd::unordered_set{ ActiveConversationTag,
-                                  PlayerConversationTag });
+        if (auto* const session = FindSession())
+        {
+            session->SetState(DialogueState::Ending);
+        }
+        ReleaseSession();
+        ClearActiveConversation();
 
-        DialogueComponentNotificationBus::Event(
-            GetEntityId(),
-            &DialogueComponentNotificationBus::Events::OnConversationEnded);
-        GlobalConversationNotificationBus::Broadcast(
-            &GlobalConversationNotificationBus::Events::OnConversationEnded,
-            GetEntityId());
+        Notify({ ConversationNotification::Ended, {}, {} });
     }
 
-    void DialogueComponent::SelectDialogue(DialogueData dialogueToSelect)
+    void DialogueComponent::MirrorConversationTags(bool involvesPlayer)
     {
-        // Selection should only be possible in 'Active' or 'Starting'.
-        if (!(m_currentState == DialogueState::Active ||
-              m_currentState == DialogueState::Starting))
+        if (!m_config.m_mirrorConversationTags)
         {
-            AZ_Error( // NOLINT
-                "DialogueComponent",
-                false,
-                "SelectDialogue should only be called while we're in the "
-                "'Active' or 'Starting' state.");
             return;
         }
 
-        if (!dialogueToSelect.IsValid())
+        LmbrCentral::TagComponentRequestBus::Event(
+            GetEntityId(),
+            &LmbrCentral::TagComponentRequests::AddTag,
+            ActiveConversationTag);
+        if (involvesPlayer)
         {
-            AZ_Error( // NOLINT
-                "DialogueComponent",
-                false,
-                "A valid dialogue is needed in order to make a selection.");
-
-            return;
+            LmbrCentral::TagComponentRequestBus::Event(
+                GetEntityId(),
+                &LmbrCentral::TagComponentRequests::AddTag,
+                PlayerConversationTag);
         }
+    }
 
-        m_activeDialogue.emplace(dialogueToSelect);
+    void DialogueComponent::ClearActiveConversation()
+    {
+        ConversationRequestBus::Broadcast(
+            &ConversationRequests::RemoveActiveConversation, GetEntityId());
 
-        UpdateAvailableResponses();
+        if (!m_config.m_mirrorConversationTags)
+        {
+            return;
+        }
 
-        // We send the dialogue out. It's considered spoken after this call.
-        DialogueComponentNotificationBus::Event(
+        // Removing the tags one at a time doesn't build a set to remove them.
+        LmbrCentral::TagComponentRequestBus::Event(
             GetEntityId(),
-            &DialogueComponentNotificationBus::Events::OnDialogue,
-            *m_activeDialogue,
-            m_availableResponses);
-
-        RunDialogueScript();
-        PlayDialogueAudio();
-        RunCinematic();
-
-        AZLOG( // NOLINT
-            LOG_FollowConversation,
-            "[Dialogue: '%s'/%s] \"%s\"",
-            GetNamedEntityId().GetName().data(),
-            m_activeDialogue->GetSpeaker().data(),
-            m_activeDialogue->GetShortText().data());
+            &LmbrCentral::TagComponentRequests::RemoveTag,
+            ActiveConversationTag);
+        LmbrCentral::TagComponentRequestBus::Event(
+            GetEntityId(),
+            &LmbrCentral::TagComponentRequests::RemoveTag,
+            PlayerConversationTag);
     }
 
-    auto DialogueComponent::TryToSelectDialogue(UniqueId const dialogueId)
-        -> bool
+    void DialogueComponent::Notify(QueuedNotification const& notification)
     {
-        auto const getDialogueOutcome =
-            m_conversationAssetRequests->GetDialogueById(dialogueId);
-        if (!getDialogueOutcome.IsSuccess())
+        auto* const queue = ConversationNotificationQueueInterface::Get();
+        if (m_config.m_queueNotifications && queue &&
+            DialogueNotificationDispatchBus::Handler::BusIsConnected())
         {
-            LOGTAG_EntityComponent(
-                "LOG_FollowConversation",
-                *this,
-                "Failed to select a dialogue using the given DialogueId.");
-            return false;
+            // By the flush, the line's conversation may have moved on or
+            // ended, so the line is kept as it was spoken.
+            auto const* const session = FindSession();
+            if (notification.m_type != ConversationNotification::Dialogue ||
+                !session || !session->HasActiveDialogue())
+            {
+                queue->Push(GetEntityId(), notification);
+                return;
+            }
+
+            auto spoken = AZStd::make_shared<SpokenDialogue>();
+            spoken->m_dialogue = session->GetActiveDialogue();
+            auto const responses = session->GetResponses();
+            spoken->m_responses.assign(responses.begin(), responses.end());
+
+            QueuedNotification queued{ notification };
+            queued.m_spokenDialogue = AZStd::move(spoken);
+            queue->Push(GetEntityId(), queued);
+            return;
         }
 
-        SelectDialogue(getDialogueOutcome.GetValue());
-        return true;
+        DispatchNotification(notification);
     }
 
-    void DialogueComponent::SelectAvailableResponse(int const responseNumber)
+    void DialogueComponent::OnAssetReady(
+        AZ::Data::Asset<AZ::Data::AssetData> asset)
     {
-        // responseNumber must begin with the chosen first number (0 or 1)
-        if (!(responseNumber >= FirstResponseNumber))
-        {
-            return;
-        }
-        // Technically, FirstResponseNumber could be set to anything, such as
-        // 15, then choice 15 would be index 0 in our response container.
-        // That is obviously ridiculous, so we limit the choice to zero or one.
-        // We set the static assert here, instead of at the declaration, so
-        // that it is not instinctively changed when changing the constant.
-        static_assert(
-            FirstResponseNumber >= 0 && FirstResponseNumber <= 1,
-            "FirstResponseNumber *MUST* be zero or one.");
+        AZ::Data::AssetBus::MultiHandler::BusDisconnect(asset.GetId());
 
-        if constexpr (FirstResponseNumber == 0)
+        AZ::Data::Asset<ConversationAsset> const* readyAsset{};
+        for (auto& conversationAsset : m_conversationAssets)
         {
-            // Exit if 0-based choice is past the upperbound [0, size).
-            if (responseNumber >= m_availableResponses.size())
+            if (conversationAsset.GetId() == asset.GetId())
             {
-                return;
+                // A ref that wasn't loaded with its entity holds no data.
+                conversationAsset = asset;
+                ResolveAudioTriggers(conversationAsset);
+                readyAsset = &conversationAsset;
             }
         }
-        else if constexpr (FirstResponseNumber == 1)
+
+        RebuildConversationIndex();
+
+        // The player may have come close while the asset was loading.
+        if (readyAsset && m_isPreloaded)
         {
-            // Exit if 1-based choice is past the upper bounds [0, size].
-            if (responseNumber > m_availableResponses.size())
+            PreloadConversationAsset(*readyAsset);
+        }
+    }
+
+    void DialogueComponent::RebuildConversationIndex()
+    {
+        MergedConversationIndex::AssetContainer assets;
+        assets.reserve(m_conversationAssets.size());
+        for (auto const& asset : m_conversationAssets)
+        {
+            // An asset that's still loading is merged once it's ready. Assets
+            // built in memory were never loaded, so they're merged as is.
+            if (asset && !asset.IsLoading())
             {
-                return;
+                assets.push_back(asset);
             }
         }
 
-        // This is why we care if the choice is 0-based or 1-based. We have to
-        // adjust our index accordingly.
-        auto dialogueToSelect{
-            m_availableResponses[responseNumber - FirstResponseNumber]
-        };
-        SelectDialogue(dialogueToSelect);
+        m_conversationIndex.Build(AZStd::move(assets));
     }
 
-    void DialogueComponent::ContinueConversation()
+    void DialogueComponent::DispatchNotification(
+        QueuedNotification const& notification)
     {
-        // Require active dialogue
-        if (!m_activeDialogue)
+        switch (notification.m_type)
         {
-            return;
+        case ConversationNotification::Started:
+            DialogueComponentNotificationBus::Event(
+                GetEntityId(),
+                &DialogueComponentNotificationBus::Events::
+                    OnConversationStarted,
+                notification.m_initiator);
+            GlobalConversationNotificationBus::Broadcast(
+                &GlobalConversationNotificationBus::Events::
+                    OnConversationStarted,
+                notification.m_initiator,
+                GetEntityId());
+            break;
+        case ConversationNotification::Dialogue:
+            SendDialogue(notification);
+            break;
+        case ConversationNotification::Aborted:
+            DialogueComponentNotificationBus::Event(
+                GetEntityId(),
+                &DialogueComponentNotificationBus::Events::
+                    OnConversationAborted);
+            GlobalConversationNotificationBus::Broadcast(
+                &GlobalConversationNotificationBus::Events::
+                    OnConversationAborted,
+                GetEntityId());
+            break;
+        case ConversationNotification::Ended:
+            DialogueComponentNotificationBus::Event(
+                GetEntityId(),
+                &DialogueComponentNotificationBus::Events::OnConversationEnded);
+            GlobalConversationNotificationBus::Broadcast(
+                &GlobalConversationNotificationBus::Events::OnConversationEnded,
+                GetEntityId());
+            break;
         }
-        // Calling continue with no available responses should end the
-        // conversation normally.
-        if (m_availableResponses.empty())
+    }
+
+    void DialogueComponent::SendDialogue(
+        QueuedNotification const& notification)
+    {
+        // Responses are only copied out if someone is listening.
+        if (!DialogueComponentNotificationBus::HasHandlers(GetEntityId()))
         {
-            EndConversation();
             return;
         }
-        // Only if the first available response is the same speaker as the
-        // active dialogue, select it. m_availableResponses is guaranteed to
-        // have at least one element due to an earlier check.
-        if (m_activeDialogue->GetSpeaker() ==
-            m_availableResponses.front().GetSpeaker())
+
+        if (notification.m_spokenDialogue)
         {
-            SelectDialogue(*m_availableResponses.begin());
+            SendSpokenDialogue(*notification.m_spokenDialogue);
             return;
         }
 
-        // FIXME: If the active dialogue's speaker is the player, we
-        // automatically choose an NPC response. This is just a workaround until
-        // proper NPC response handling is implemented.
-        if (m_activeDialogue->GetSpeaker() == PlayerSpeakerTag)
+        auto const& dialogueId = notification.m_dialogueId;
+        auto* const session = FindSession();
+        if (!session || !session->HasActiveDialogue() ||
+            session->GetActiveDialogue().GetId() != dialogueId)
         {
-            auto const firstAvailableResponseIter =
-                m_availableResponses.begin();
-            if (firstAvailableResponseIter != m_availableResponses.end() &&
-                firstAvailableResponseIter->GetSpeaker() != PlayerSpeakerTag)
-            {
-                SelectDialogue(*firstAvailableResponseIter);
-            }
+            return;
         }
-    }
 
-    auto DialogueComponent::CheckAvailability(
-        DialogueData const& dialogueData) const -> bool
-    {
-        // All availability checks must pass for a dialogue to be available.
-        bool const isDialogueAvailable = [this, &dialogueData]() -> bool
+        DialoguePayload const payload{ &session->GetActiveDialogue(),
+                                       session->GetResponses() };
+        DialogueComponentNotificationBus::Event(
+            GetEntityId(),
+            &DialogueComponentNotificationBus::Events::OnDialogueSpoken,
+            payload);
+
+        // A listener may have already moved the conversation on.
+        if (auto* const spokenSession = FindSession(); IsOnDialogueWanted() &&
+            spokenSession && spokenSession->HasActiveDialogue() &&
+            spokenSession->GetActiveDialogue().GetId() == dialogueId)
         {
-            // NOTE: A DialogueData is, by default, available, unless a handler
-            // explicitly sets it to false.
-            AZ::EBusReduceResult<bool, AZStd::logical_and<bool>> result(true);
-            AvailabilityRequestBus::EventResult(
-                result,
+            DialogueComponentNotificationBus::Event(
                 GetEntityId(),
-                &AvailabilityRequestBus::Events::IsAvailable,
-                AZ::Name(dialogueData.GetAvailabilityId().GetHash())
-                    .GetStringView());
-            return result.value;
-        }();
-
-        return isDialogueAvailable;
+                &DialogueComponentNotificationBus::Events::OnDialogue,
+                spokenSession->GetActiveDialogue(),
+                spokenSession->CopyResponses());
+        }
     }
 
-    auto DialogueComponent::CheckAvailabilityById(
-        UniqueId const& dialogueId) const -> bool
+    void DialogueComponent::SendSpokenDialogue(SpokenDialogue const& spoken)
     {
-        auto const getDialogueOutcome =
-            m_conversationAssetRequests->GetDialogueById(dialogueId);
-        return getDialogueOutcome.IsSuccess()
-            ? CheckAvailability(getDialogueOutcome.GetValue())
-            : false;
-    }
+        DialoguePayload const payload{ &spoken.m_dialogue,
+                                       spoken.m_responses };
+        DialogueComponentNotificationBus::Event(
+            GetEntityId(),
+            &DialogueComponentNotificationBus::Events::OnDialogueSpoken,
+            payload);
 
-    void DialogueComponent::UpdateAvailableResponses()
-    {
-        m_availableResponses.clear();
+        if (!IsOnDialogueWanted())
+        {
+            return;
+        }
 
-        // Check all responses and determine which should be available for use.
-        for (UniqueId const& responseId : m_activeDialogue->GetResponseIds())
+        AZStd::vector<DialogueData> responses(spoken.m_responses.size());
+        for (size_t index{}; index < responses.size(); ++index)
         {
-            AZ::Outcome<DialogueData> const responseDialogueOutcome =
-                m_conversationAssetRequests->GetDialogueById(responseId);
-            // An invalid ID means we didn't find a dialogue matching the
-            // responseId. We can only check valid dialogues, so we skip ahead
-            // if invalid.
-            if (!responseDialogueOutcome.IsSuccess())
-            {
-                continue;
-            }
+            ConversationSession::CopyDialogue(
+                spoken.m_responses[index], responses[index]);
+        }
+
+        DialogueComponentNotificationBus::Event(
+            GetEntityId(),
+            &DialogueComponentNotificationBus::Events::OnDialogue,
+            spoken.m_dialogue,
+            responses);
+    }
 
-            if (CheckAvailability(responseDialogueOutcome.GetValue()))
+    auto DialogueComponent::IsOnDialogueWanted() const -> bool
+    {
+        // OnDialogue copies every response, so only send it if it's wanted.
+        bool isOnDialogueWanted{};
+        DialogueComponentNotificationBus::EnumerateHandlersId(
+            GetEntityId(),
+            [&isOnDialogueWanted](DialogueComponentNotifications* handler)
+                -> bool
             {
-                m_availableResponses.push_back(
-                    responseDialogueOutcome.GetValue());
-            }
-        }
+                isOnDialogueWanted = handler->WantsOnDialogue();
+                return !isOnDialogueWanted;
+            });
+        return isOnDialogueWanted;
     }
 
-    void DialogueComponent::RunDialogueScript() const
+    void DialogueComponent::ReleaseSession()
     {
-        if (!m_activeDialogue.has_value())
+        if (auto* const session = FindSession())
         {
-            LOGTAG_EntityComponent(
-                "DialogueComponent",
-                *this,
-                "Unable to run a companion script without an active dialogue.");
-
-            return;
+            CancelDelayedStep(*session);
+            ReleaseHeldText(session->TakeSpeculativeText());
         }
 
-        auto const nodeId{ m_activeDialogue->GetId().GetName() };
-
-        DialogueScriptRequestBus::Event(
-            GetEntityId(), &DialogueScriptRequests::RunDialogueScript, nodeId);
+        ReleaseDialogueText();
+        ConversationSessionPool::Get().Release(m_sessionHandle);
+        m_sessionHandle = {};
     }
 
-    void DialogueComponent::PlayDialogueAudio() const
+    void DialogueComponent::SelectDialogue(DialogueData dialogueToSelect)
     {
-        // TODO: Use AudioTriggerComponentBus instead.
-        if (m_activeDialogue.has_value() &&
-            !m_activeDialogue->GetAudioControl().IsEmpty())
-        {
-            LmbrCentral::AudioSystemComponentRequestBus::Broadcast(
-                &LmbrCentral::AudioSystemComponentRequests::
-                    GlobalExecuteAudioTrigger,
-                m_activeDialogue->GetAudioControl().GetName().data(),
-                GetEntityId());
-        }
+        MakeDialogueActive(dialogueToSelect);
     }
 
-    void DialogueComponent::RunCinematic() const
+    void DialogueComponent::MakeDialogueActive(DialogueData const& dialogue)
     {
-        if (!m_activeDialogue.has_value())
+        // Selection should only be possible in 'Active' or 'Starting'.
+        auto* const session = FindSession();
+        if (!session ||
+            !(session->GetState() == DialogueState::Active ||
+              session->GetState() == DialogueState::Starting))
         {
-            LOGTAG_EntityComponent(
+            AZ_Error( // NOLINT
                 "DialogueComponent",
-                *this,
-                "Unable to start a cinematic without an active dialogue.");
+                false,
+                "SelectDialogue should only be called while we're in the "
+                "'Active' or 'Starting' state.");
+            return;
+        }
 
+        if (!dialogue.IsValid())
+        {
+            AZ_Error( // NOLINT
+                "DialogueComponent",
+                false,
+                "A valid dialogue is needed in order to make a selection.");
+
+            return;
+        }
+
+        // Whatever the previous dialogue was waiting on no longer applies.
+        CancelDelayedStep(*session);
+        session->SetActiveDialogue(dialogue);
+
+        // Responses worked out while the previous dialogue was on screen are
+        // committed as they are.
+        auto const* const conversation = ConversationInterface::Get();
+        auto const* const speculativeResponses = conversation
+            ? session->FindSpeculativeResponses(
+                  dialogue.GetId(), conversation->GetWorldStateEpoch())
+            : nullptr;
+        if (speculativeResponses)
+        {
+            session->SetResponses(*speculativeResponses);
+        }
+        else
+        {
+            UpdateAvailableResponses();
+        }
+
+        // Speculative text is let go once the selection holds its own.
+        auto const speculativeText = session->TakeSpeculativeText();
+        session->StopSpeculation();
+
+        // Assets that stream their text need it loaded before the dialogue
+        // can be spoken.
+        if (auto text = CollectStreamedText(); !text.empty())
+        {
+            LoadActiveDialogueText(AZStd::move(text));
+        }
+        else
+        {
+            ReleaseDialogueText();
+            EnterActiveDialogue();
+        }
+
+        ReleaseHeldText(speculativeText);
+    }
+
+    void DialogueComponent::EnterActiveDialogue()
+    {
+        auto* const session = FindSession();
+        if (!session || !session->HasActiveDialogue())
+        {
+            return;
+        }
+
+        auto const entryDelay = session->GetActiveDialogue().GetEntryDelay();
+        if (entryDelay > 0.0f &&
+            ScheduleDelayedStep(
+                *session,
+                ConversationSession::DelayedStep::Speak,
+                entryDelay))
+        {
+            return;
+        }
+
+        SpeakActiveDialogue();
+    }
+
+    void DialogueComponent::SpeakActiveDialogue()
+    {
+        auto* const session = FindSession();
+        if (!session || !session->HasActiveDialogue())
+        {
+            return;
+        }
+
+        // Logged up front, since a handler may end the conversation.
+        AZLOG( // NOLINT
+            LOG_FollowConversation,
+            "[Dialogue: '%s'/%s] \"%s\"",
+            GetNamedEntityId().GetName().data(),
+            session->GetActiveDialogue().GetSpeaker().data(),
+            session->GetActiveDialogue().GetShortText().data());
+
+        auto const spokenId = session->GetActiveDialogue().GetId();
+        auto const exitDelay = session->GetActiveDialogue().GetExitDelay();
+
+        // We send the dialogue out. It's considered spoken after this call.
+        Notify({ ConversationNotification::Dialogue, {}, spokenId });
+
+        RunDialogueScript();
+        PlayDialogueAudio();
+        RunCinematic();
+        StartSpeculation();
+
+        if (exitDelay <= 0.0f)
+        {
+            return;
+        }
+
+        // The conversation moves on by itself once the exit delay is over,
+        // unless something we just notified already moved it on.
+        auto* const spokenSession = FindSession();
+        if (spokenSession && spokenSession->HasActiveDialogue() &&
+            spokenSession->GetActiveDialogue().GetId() == spokenId &&
+            spokenSession->GetDelayedStep() ==
+                ConversationSession::DelayedStep::None)
+        {
+            ScheduleDelayedStep(
+                *spokenSession,
+                ConversationSession::DelayedStep::Continue,
+                exitDelay);
+        }
+    }
+
+    auto DialogueComponent::ScheduleDelayedStep(
+        ConversationSession& session,
+        ConversationSession::DelayedStep step,
+        float delaySeconds) -> bool
+    {
+        auto* const scheduler = DialogueSchedulerInterface::Get();
+        if (!scheduler)
+        {
+            return false;
+        }
+
+        auto const timer =
+            scheduler->ScheduleSessionTimer(m_sessionHandle, delaySeconds);
+        session.SetDelayedStep(step, timer);
+        return true;
+    }
+
+    void DialogueComponent::CancelDelayedStep(ConversationSession& session)
+    {
+        if (session.GetDelayedStep() == ConversationSession::DelayedStep::None)
+        {
+            return;
+        }
+
+        if (auto* const scheduler = DialogueSchedulerInterface::Get())
+        {
+            scheduler->CancelSessionTimer(session.GetDelayTimer());
+        }
+
+        session.ClearDelayedStep();
+    }
+
+    void DialogueComponent::OnDelayElapsed()
+    {
+        auto* const session = FindSession();
+        if (!session)
+        {
+            return;
+        }
+
+        auto const step = session->GetDelayedStep();
+        session->ClearDelayedStep();
+
+        switch (step)
+        {
+        case ConversationSession::DelayedStep::Speak:
+            SpeakActiveDialogue();
+            break;
+        case ConversationSession::DelayedStep::Continue:
+            ContinueConversation();
+            break;
+        default:
+            break;
+        }
+    }
+
+    auto DialogueComponent::CollectStreamedText() const
+        -> ConversationSession::HeldTextContainer
+    {
+        ConversationSession::HeldTextContainer text;
+
+        auto const* const session = FindSession();
+        if (!session || !session->HasActiveDialogue())
+        {
+            return text;
+        }
+
+        auto const activeId = session->GetActiveDialogue().GetId();
+        AddStreamedText(text, m_conversationIndex.GetDialogueHandle(activeId));
+        for (DialogueHandle const& response : session->GetResponses())
+        {
+            AddStreamedText(text, response);
+        }
+
+        return text;
+    }
+
+    void DialogueComponent::LoadActiveDialogueText(
+        ConversationSession::HeldTextContainer text)
+    {
+        bool const isLoaded = AZStd::all_of(
+            text.begin(),
+            text.end(),
+            [](ConversationSession::HeldText const& held)
+            {
+                return AZStd::all_of(
+                    held.m_indices.begin(),
+                    held.m_indices.end(),
+                    [&held](DialogueIndex const index)
+                    {
+                        return held.m_store->IsLoaded(index);
+                    });
+            });
+
+        // The new text is held before the previous text is released, so text
+        // shared by both selections is never dropped in between.
+        auto* const session = FindSession();
+        if (!session)
+        {
+            return;
+        }
+
+        auto& heldText = session->GetHeldText();
+        auto const previousText = AZStd::exchange(heldText, AZStd::move(text));
+        auto const serial = session->NextTextLoadSerial();
+        // Each store calls back separately, possibly on different threads.
+        auto const remaining =
+            AZStd::make_shared<AZStd::atomic<size_t>>(heldText.size());
+
+        for (ConversationSession::HeldText const& held : heldText)
+        {
+            if (isLoaded)
+            {
+                held.m_store->Load(held.m_indices, {});
+                continue;
+            }
+
+            held.m_store->Load(
+                held.m_indices,
+                [this,
+                 serial,
+                 remaining,
+                 sessionHandle = m_sessionHandle,
+                 alive = AZStd::weak_ptr<bool>(m_aliveToken)]()
+                {
+                    if (--*remaining > 0)
+                    {
+                        return;
+                    }
+
+                    AZ::TickBus::QueueFunction(
+                        [this, serial, sessionHandle, alive]()
+                        {
+                            // The handle goes stale if the conversation ends,
+                            // even if the session is reused.
+                            auto const* const session =
+                                ConversationSessionPool::Get().Find(
+                                    sessionHandle);
+                            if (!alive.expired() && session &&
+                                serial == session->GetTextLoadSerial())
+                            {
+                                OnActiveDialogueTextLoaded();
+                            }
+                        });
+                });
+        }
+
+        for (ConversationSession::HeldText const& held : previousText)
+        {
+            held.m_store->Release(held.m_indices);
+        }
+
+        if (isLoaded)
+        {
+            OnActiveDialogueTextLoaded();
+        }
+    }
+
+    void DialogueComponent::OnActiveDialogueTextLoaded()
+    {
+        auto* const session = FindSession();
+        if (!session || !session->HasActiveDialogue())
+        {
+            return;
+        }
+
+        // Responses pick their text up when they're copied out.
+        auto const activeId = session->GetActiveDialogue().GetId();
+        DialogueChunk chunk;
+        chunk.SetData(
+            m_conversationIndex.GetDialogueHandle(activeId).GetChunkText());
+        session->SetActiveChunk(chunk);
+
+        EnterActiveDialogue();
+    }
+
+    void DialogueComponent::ReleaseDialogueText()
+    {
+        auto* const session = FindSession();
+        if (!session)
+        {
+            return;
+        }
+
+        // Any load still in flight is for a selection that no longer exists.
+        session->NextTextLoadSerial();
+
+        auto& heldText = session->GetHeldText();
+        for (ConversationSession::HeldText const& held : heldText)
+        {
+            held.m_store->Release(held.m_indices);
+        }
+
+        heldText.clear();
+    }
+
+    auto DialogueComponent::TryToSelectDialogue(UniqueId const dialogueId)
+        -> bool
+    {
+        DialogueView const dialogue =
+            m_conversationIndex.GetDialogueHandle(dialogueId).GetView();
+        if (!dialogue.IsValid())
+        {
+            LOGTAG_EntityComponent(
+                "LOG_FollowConversation",
+                *this,
+                "Failed to select a dialogue using the given DialogueId.");
+            return false;
+        }
+
+        MakeDialogueActive(dialogue.GetDialogue());
+        return true;
+    }
+
+    void DialogueComponent::SelectAvailableResponse(int const responseNumber)
+    {
+        // responseNumber must begin with the chosen first number (0 or 1)
+        if (!(responseNumber >= FirstResponseNumber))
+        {
+            return;
+        }
+        // Technically, FirstResponseNumber could be set to anything, such as
+        // 15, then choice 15 would be index 0 in our response container.
+        // That is obviously ridiculous, so we limit the choice to zero or one.
+        // We set the static assert here, instead of at the declaration, so
+        // that it is not instinctively changed when changing the constant.
+        static_assert(
+            FirstResponseNumber >= 0 && FirstResponseNumber <= 1,
+            "FirstResponseNumber *MUST* be zero or one.");
+
+        auto const* const session = FindSession();
+        if (!session)
+        {
+            return;
+        }
+
+        auto const responses = session->GetResponses();
+        if constexpr (FirstResponseNumber == 0)
+        {
+            // Exit if 0-based choice is past the upperbound [0, size).
+            if (responseNumber >= responses.size())
+            {
+                return;
+            }
+        }
+        else if constexpr (FirstResponseNumber == 1)
+        {
+            // Exit if 1-based choice is past the upper bounds [0, size].
+            if (responseNumber > responses.size())
+            {
+                return;
+            }
+        }
+
+        // This is why we care if the choice is 0-based or 1-based. We have to
+        // adjust our index accordingly.
+        auto const* const dialogueToSelect =
+            responses[responseNumber - FirstResponseNumber].GetDialogue();
+        MakeDialogueActive(*dialogueToSelect);
+    }
+
+    void DialogueComponent::ContinueConversation()
+    {
+        // Require active dialogue
+        auto const* const session = FindSession();
+        if (!session || !session->HasActiveDialogue())
+        {
+            return;
+        }
+        // Calling continue with no available responses should end the
+        // conversation normally.
+        if (!session->HasResponses())
+        {
+            EndConversation();
+            return;
+        }
+        // Only if the first available response is the same speaker as the
+        // active dialogue, select it. The session is guaranteed to have at
+        // least one response due to an earlier check.
+        auto const activeSpeaker = session->GetActiveDialogue().GetSpeaker();
+        DialogueHandle const firstResponse = session->GetResponses().front();
+        if (activeSpeaker == firstResponse.GetSpeaker())
+        {
+            MakeDialogueActive(*firstResponse.GetDialogue());
+            return;
+        }
+
+        // FIXME: If the active dialogue's speaker is the player, we
+        // automatically choose an NPC response. This is just a workaround until
+        // proper NPC response handling is implemented.
+        if (activeSpeaker == PlayerSpeakerTag &&
+            firstResponse.GetSpeaker() != PlayerSpeakerTag)
+        {
+            MakeDialogueActive(*firstResponse.GetDialogue());
+        }
+    }
+
+    auto DialogueComponent::CheckAvailability(
+        DialogueData const& dialogueData) const -> bool
+    {
+        // Native conditions are cheaper to run than to look up.
+        if (auto const& condition = dialogueData.GetCondition();
+            !condition.IsEmpty())
+        {
+            return condition.Evaluate(ConditionFactsInterface::Get());
+        }
+
+        auto const availabilityId = dialogueData.GetAvailabilityId();
+
+        auto* const cache = GetAvailabilityCache();
+        if (!cache)
+        {
+            return QueryAvailability(dialogueData);
+        }
+
+        auto const [iter, isNew] =
+            cache->try_emplace(availabilityId.GetHash(), false);
+        if (isNew)
+        {
+            iter->second = QueryAvailability(dialogueData);
+        }
+
+        return iter->second;
+    }
+
+    auto DialogueComponent::CheckAvailabilities(
+        AZStd::span<DialogueData const* const> dialogues) const
+        -> AvailabilityMask
+    {
+        AZ_Assert( // NOLINT
+            dialogues.size() <= MaxAvailabilityBatchSize,
+            "Too many dialogues to check in one batch.");
+
+        auto* const cache = GetAvailabilityCache();
+        AvailabilityMask mask{};
+
+        // Only the answers missing from the cache are asked for.
+        m_availabilityQuery.clear();
+        m_availabilityScriptIndices.clear();
+        AZStd::fixed_vector<size_t, MaxAvailabilityBatchSize> queryBits;
+        for (size_t bit{}; bit < dialogues.size(); ++bit)
+        {
+            if (auto const& condition = dialogues[bit]->GetCondition();
+                !condition.IsEmpty())
+            {
+                auto const isAvailable =
+                    condition.Evaluate(ConditionFactsInterface::Get());
+                mask |= AvailabilityMask{ isAvailable } << bit;
+                continue;
+            }
+
+            auto const availabilityId = dialogues[bit]->GetAvailabilityId();
+            if (cache)
+            {
+                if (auto const iter = cache->find(availabilityId.GetHash());
+                    iter != cache->end())
+                {
+                    mask |= AvailabilityMask{ iter->second } << bit;
+                    continue;
+                }
+            }
+
+            if (auto const key = FindAvailabilityKey(*dialogues[bit]))
+            {
+                m_availabilityQuery.emplace_back(*key);
+            }
+            else
+            {
+                m_availabilityQuery.emplace_back(
+                    AZ::Name(availabilityId.GetHash()).GetStringView());
+            }
+
+            m_availabilityScriptIndices.push_back(
+                dialogues[bit]->GetAvailabilityScriptIndex());
+            queryBits.push_back(bit);
+        }
+
+        if (queryBits.empty())
+        {
+            return mask;
+        }
+
+        // Every handler has to agree, and a dialogue is available unless a
+        // handler says otherwise.
+        AZ::EBusReduceResult<AvailabilityMask, AvailabilityMaskIntersection>
+            result(~AvailabilityMask{});
+        AvailabilityRequestBus::EventResult(
+            result,
+            GetEntityId(),
+            &AvailabilityRequestBus::Events::AreAvailableByIndex,
+            m_availabilityScriptIndices,
+            m_availabilityQuery);
+
+        for (size_t query{}; query < queryBits.size(); ++query)
+        {
+            bool const isAvailable = ((result.value >> query) & 1U) != 0;
+            if (cache)
+            {
+                cache->insert_or_assign(
+                    dialogues[queryBits[query]]->GetAvailabilityId().GetHash(),
+                    isAvailable);
+            }
+
+            mask |= AvailabilityMask{ isAvailable } << queryBits[query];
+        }
+
+        return mask;
+    }
+
+    auto DialogueComponent::GetAvailabilityCache() const -> AvailabilityCache*
+    {
+        // Without a conversation system there's no epoch telling us when the
+        // game state changed, so nothing can be cached.
+        auto const* const conversation = ConversationInterface::Get();
+        if (!m_config.m_cacheAvailability || !conversation)
+        {
+            return nullptr;
+        }
+
+        if (auto const epoch = conversation->GetWorldStateEpoch();
+            epoch != m_availabilityCacheEpoch)
+        {
+            m_availabilityCache.clear();
+            m_availabilityCacheEpoch = epoch;
+        }
+
+        return &m_availabilityCache;
+    }
+
+    auto DialogueComponent::FindAvailabilityKey(
+        DialogueData const& dialogueData) const
+        -> AZStd::optional<AZStd::string_view>
+    {
+        auto const handle =
+            m_conversationIndex.GetDialogueHandle(dialogueData.GetId());
+        auto const* const asset = handle.GetAsset();
+        // The dialogue may be a modified copy, so its key is only used if the
+        // availability ID still matches.
+        if (!asset || !asset->HasAvailabilityKeys() ||
+            handle.GetView().GetAvailabilityId() !=
+                dialogueData.GetAvailabilityId())
+        {
+            return AZStd::nullopt;
+        }
+
+        return asset->GetAvailabilityKey(handle.GetIndex());
+    }
+
+    auto DialogueComponent::QueryAvailability(
+        DialogueData const& dialogueData) const -> bool
+    {
+        // All availability checks must pass for a dialogue to be available.
+        // NOTE: A DialogueData is, by default, available, unless a handler
+        // explicitly sets it to false.
+        auto const query = [this, &dialogueData](
+                               AZStd::string_view availabilityKey) -> bool
+        {
+            // A check in the companion script's function table is asked for
+            // by index, as a batch of one.
+            if (auto const scriptIndex =
+                    dialogueData.GetAvailabilityScriptIndex();
+                scriptIndex != DialogueData::NoScriptIndex)
+            {
+                m_availabilityQuery.assign(1, AZStd::string{ availabilityKey });
+                m_availabilityScriptIndices.assign(1, scriptIndex);
+
+                AZ::EBusReduceResult<
+                    AvailabilityMask,
+                    AvailabilityMaskIntersection>
+                    result(~AvailabilityMask{});
+                AvailabilityRequestBus::EventResult(
+                    result,
+                    GetEntityId(),
+                    &AvailabilityRequestBus::Events::AreAvailableByIndex,
+                    m_availabilityScriptIndices,
+                    m_availabilityQuery);
+                return (result.value & 1U) != 0;
+            }
+
+            AZ::EBusReduceResult<bool, AZStd::logical_and<bool>> result(true);
+            AvailabilityRequestBus::EventResult(
+                result,
+                GetEntityId(),
+                &AvailabilityRequestBus::Events::IsAvailable,
+                availabilityKey);
+            return result.value;
+        };
+
+        if (auto const key = FindAvailabilityKey(dialogueData))
+        {
+            return query(*key);
+        }
+
+        // Dialogues from outside our assets, or from assets built in memory,
+        // have no resolved key, so their name has to be looked up.
+        AZ::Name const name{ dialogueData.GetAvailabilityId().GetHash() };
+        return query(name.GetStringView());
+    }
+
+    auto DialogueComponent::CheckAvailabilityById(
+        UniqueId const& dialogueId) const -> bool
+    {
+        DialogueView const dialogue =
+            m_conversationIndex.GetDialogueHandle(dialogueId).GetView();
+        return dialogue.IsValid() ? CheckAvailability(dialogue.GetDialogue())
+                                  : false;
+    }
+
+    void DialogueComponent::AppendStartingDialogues(
+        AZStd::vector<DialogueView>& dialogues) const
+    {
+        if (GetCurrentState() != DialogueState::Inactive)
+        {
+            return;
+        }
+
+        for (UniqueId const& startingId : m_conversationIndex.GetStartingIds())
+        {
+            if (DialogueView const dialogue =
+                    m_conversationIndex.GetDialogueHandle(startingId).GetView();
+                dialogue.IsValid())
+            {
+                dialogues.push_back(dialogue);
+            }
+        }
+    }
+
+    auto DialogueComponent::GetPreloadPosition() const -> AZ::Vector3
+    {
+        AZ::Vector3 position = AZ::Vector3::CreateZero();
+        AZ::TransformBus::EventResult(
+            position,
+            GetEntityId(),
+            &AZ::TransformBus::Events::GetWorldTranslation);
+        return position;
+    }
+
+    void DialogueComponent::Preload()
+    {
+        if (m_isPreloaded)
+        {
+            return;
+        }
+
+        m_isPreloaded = true;
+
+        QueuePreload(m_config.m_companionScript);
+        QueuePreload(m_config.m_speakerIconPath);
+        for (auto const& asset : m_conversationAssets)
+        {
+            // An asset that isn't resident yet is loaded now. OnAssetReady
+            // merges it in and reads ahead the rest.
+            if (asset.IsReady())
+            {
+                PreloadConversationAsset(asset);
+            }
+            else if (!asset.IsLoading())
+            {
+                QueuePreload(asset);
+            }
+        }
+    }
+
+    void DialogueComponent::QueuePreload(
+        AZ::Data::Asset<AZ::Data::AssetData> asset)
+    {
+        if (!asset.GetId().IsValid())
+        {
+            return;
+        }
+
+        asset.QueueLoad();
+        m_preloadedAssets.push_back(AZStd::move(asset));
+    }
+
+    void DialogueComponent::PreloadConversationAsset(
+        AZ::Data::Asset<ConversationAsset> const& asset)
+    {
+        QueuePreload(asset->GetMainScriptAsset());
+
+        // Only the text a conversation opens with is worth reading ahead.
+        ConversationSession::HeldTextContainer text;
+        for (UniqueId const& startingId : asset->GetStartingIds())
+        {
+            AddStreamedText(
+                text, m_conversationIndex.GetDialogueHandle(startingId));
+        }
+
+        for (ConversationSession::HeldText& held : text)
+        {
+            held.m_store->Load(held.m_indices, {});
+            if (m_preloadedText.size() < m_preloadedText.capacity())
+            {
+                m_preloadedText.push_back(AZStd::move(held));
+            }
+            else
+            {
+                held.m_store->Release(held.m_indices);
+            }
+        }
+    }
+
+    void DialogueComponent::ReleasePreload()
+    {
+        for (ConversationSession::HeldText const& held : m_preloadedText)
+        {
+            held.m_store->Release(held.m_indices);
+        }
+
+        m_preloadedText.clear();
+        m_preloadedAssets.clear();
+        m_isPreloaded = false;
+    }
+
+    void DialogueComponent::UpdateAvailableResponses()
+    {
+        auto* const session = FindSession();
+        if (!session || !session->HasActiveDialogue())
+        {
+            return;
+        }
+
+        session->SetResponses(
+            FindAvailableResponses(session->GetActiveDialogue()));
+    }
+
+    auto DialogueComponent::FindAvailableResponses(
+        DialogueData const& dialogue) const
+        -> ConversationSession::ResponseHandles
+    {
+        static_assert(
+            DialogueData::MaxResponses <= MaxAvailabilityBatchSize,
+            "Every response must fit in one availability check.");
+
+        ConversationSession::ResponseHandles candidates;
+        AZStd::fixed_vector<DialogueData const*, DialogueData::MaxResponses>
+            responses;
+
+        // The index resolves every response ahead of time, across assets, so
+        // when the dialogue came from it we only walk a run of handles.
+        auto const dialogueId = dialogue.GetId();
+        if (m_conversationIndex.GetDialogueHandle(dialogueId).IsValid())
+        {
+            for (DialogueHandle const& response :
+                 m_conversationIndex.GetResponseHandles(dialogueId))
+            {
+                if (candidates.size() == candidates.capacity())
+                {
+                    break;
+                }
+
+                candidates.push_back(response);
+                responses.push_back(response.GetDialogue());
+            }
+        }
+        else
+        {
+            for (UniqueId const& responseId : dialogue.GetResponseIds())
+            {
+                // Responses we can't find are skipped, since there's nothing
+                // to check.
+                auto const response =
+                    m_conversationIndex.GetDialogueHandle(responseId);
+                if (response.IsValid() &&
+                    candidates.size() < candidates.capacity())
+                {
+                    candidates.push_back(response);
+                    responses.push_back(response.GetDialogue());
+                }
+            }
+        }
+
+        // All responses are checked in one round trip to the handlers.
+        auto const availableMask = CheckAvailabilities(responses);
+        ConversationSession::ResponseHandles availableResponses;
+        for (size_t bit{}; bit < candidates.size(); ++bit)
+        {
+            if (((availableMask >> bit) & 1U) != 0)
+            {
+                availableResponses.push_back(candidates[bit]);
+            }
+        }
+
+        return availableResponses;
+    }
+
+    void DialogueComponent::StartSpeculation()
+    {
+        auto* const session = FindSession();
+        auto const* const conversation = ConversationInterface::Get();
+        // Without an epoch there's no telling whether the results went stale.
+        if (!m_config.m_precomputeNextLevel || !session || !conversation ||
+            !session->HasResponses())
+        {
+            return;
+        }
+
+        ReleaseHeldText(session->TakeSpeculativeText());
+        auto const serial =
+            session->RestartSpeculation(conversation->GetWorldStateEpoch());
+        AZ::TickBus::QueueFunction(
+            [this, serial, alive = AZStd::weak_ptr<bool>(m_aliveToken)]()
+            {
+                if (!alive.expired())
+                {
+                    SpeculateResponse(serial, 0);
+                }
+            });
+    }
+
+    void DialogueComponent::SpeculateResponse(
+        AZ::u32 serial, size_t responseIndex)
+    {
+        // The speculation goes stale once a selection is made.
+        auto* const session = FindSession();
+        if (!session || session->GetSpeculationSerial() != serial ||
+            responseIndex >= session->GetResponses().size())
+        {
+            return;
+        }
+
+        DialogueHandle const response =
+            session->GetResponses()[responseIndex];
+        auto const* const responseDialogue = response.GetDialogue();
+        if (responseDialogue)
+        {
+            auto const responses = FindAvailableResponses(*responseDialogue);
+            session->AddSpeculativeStep(responseDialogue->GetId(), responses);
+
+            // Read ahead the text that selecting the response would wait on.
+            ConversationSession::HeldTextContainer text;
+            AddStreamedText(text, response);
+            for (DialogueHandle const& nextResponse : responses)
+            {
+                AddStreamedText(text, nextResponse);
+            }
+
+            auto& speculativeText = session->GetSpeculativeText();
+            for (ConversationSession::HeldText& held : text)
+            {
+                held.m_store->Load(held.m_indices, {});
+                speculativeText.push_back(AZStd::move(held));
+            }
+        }
+
+        // One response per tick keeps the work off any single frame.
+        if (responseIndex + 1 < session->GetResponses().size())
+        {
+            AZ::TickBus::QueueFunction(
+                [this,
+                 serial,
+                 responseIndex,
+                 alive = AZStd::weak_ptr<bool>(m_aliveToken)]()
+                {
+                    if (!alive.expired())
+                    {
+                        SpeculateResponse(serial, responseIndex + 1);
+                    }
+                });
+        }
+    }
+
+    void DialogueComponent::ReleaseHeldText(
+        AZStd::span<ConversationSession::HeldText const> text)
+    {
+        for (ConversationSession::HeldText const& held : text)
+        {
+            held.m_store->Release(held.m_indices);
+        }
+    }
+
+    auto DialogueComponent::GetAvailableResponses() const
+        -> AZStd::vector<DialogueData>
+    {
+        auto const* const session = FindSession();
+        if (!session)
+        {
+            return {};
+        }
+
+        auto const responses = session->GetResponses();
+        AZStd::vector<DialogueData> copies(responses.size());
+        for (size_t index{}; index < responses.size(); ++index)
+        {
+            ConversationSession::CopyDialogue(responses[index], copies[index]);
+        }
+
+        return copies;
+    }
+
+    void DialogueComponent::RunDialogueScript() const
+    {
+        auto const* const session = FindSession();
+        if (!session || !session->HasActiveDialogue())
+        {
+            LOGTAG_EntityComponent(
+                "DialogueComponent",
+                *this,
+                "Unable to run a companion script without an active dialogue.");
+
+            return;
+        }
+
+        auto const& dialogue = session->GetActiveDialogue();
+        if (auto const scriptIndex = dialogue.GetScriptIndex();
+            scriptIndex != DialogueData::NoScriptIndex)
+        {
+            DialogueScriptRequestBus::Event(
+                GetEntityId(),
+                &DialogueScriptRequests::RunDialogueScriptByIndex,
+                scriptIndex);
+            return;
+        }
+
+        // Dialogues without an index are from assets built before the
+        // function table, so their script is looked up by name.
+        auto const nodeId{ dialogue.GetId().GetName() };
+
+        DialogueScriptRequestBus::Event(
+            GetEntityId(), &DialogueScriptRequests::RunDialogueScript, nodeId);
+    }
+
+    void DialogueComponent::PlayDialogueAudio() const
+    {
+        // TODO: Use AudioTriggerComponentBus instead.
+        auto const* const session = FindSession();
+        if (!session || !session->HasActiveDialogue())
+        {
+            return;
+        }
+
+        auto const& dialogue = session->GetActiveDialogue();
+        auto const& audioControl = dialogue.GetAudioControl();
+        if (audioControl.IsEmpty())
+        {
+            return;
+        }
+
+        // The trigger ID resolved when the asset was ready is used, unless
+        // the dialogue isn't from one of our assets or no longer matches it.
+        // A trigger that wasn't found then is looked up by name below, since
+        // its control may have been loaded since.
+        auto const handle =
+            m_conversationIndex.GetDialogueHandle(dialogue.GetId());
+        auto const* const asset = handle.GetAsset();
+        auto* const audioSystem = AZ::Interface<Audio::IAudioSystem>::Get();
+        if (asset && asset->HasAudioTriggerIds() && audioSystem &&
+            handle.GetView().GetDialogue().GetAudioControl().GetName() ==
+                audioControl.GetName())
+        {
+            if (auto const triggerId =
+                    asset->GetAudioTriggerId(handle.GetIndex());
+                triggerId != ConversationAsset::NoAudioTrigger)
+            {
+                // The same request GlobalExecuteAudioTrigger makes, minus the
+                // name lookup.
+                Audio::ObjectRequest::ExecuteTrigger executeTrigger;
+                executeTrigger.m_triggerId = triggerId;
+                executeTrigger.m_owner = reinterpret_cast<void*>( // NOLINT
+                    static_cast<uintptr_t>(
+                        static_cast<AZ::u64>(GetEntityId())));
+                audioSystem->PushRequest(AZStd::move(executeTrigger));
+                return;
+            }
+        }
+
+        LmbrCentral::AudioSystemComponentRequestBus::Broadcast(
+            &LmbrCentral::AudioSystemComponentRequests::
+                GlobalExecuteAudioTrigger,
+            audioControl.GetName().data(),
+            GetEntityId());
+    }
+
+    void DialogueComponent::RunCinematic() const
+    {
+        auto const* const session = FindSession();
+        if (!session || !session->HasActiveDialogue())
+        {
+            LOGTAG_EntityComponent(
+                "DialogueComponent",
+                *this,
+                "Unable to start a cinematic without an active dialogue.");
+
+            return;
+        }
+
+        DialogueData const& activeDialogue = session->GetActiveDialogue();
+        if (!activeDialogue.HasCinematic())
+        {
             return;
         }
 
         CinematicRequestBus::Broadcast(
             &CinematicRequests::StartCinematic,
-            m_activeDialogue->GetCinematicId());
+            activeDialogue.GetCinematicId());
     }
 
 } // namespace Conversation
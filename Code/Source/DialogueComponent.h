@@ -1,18 +1,27 @@
 #pragma once
 
+#include "AzCore/Asset/AssetCommon.h"
 #include "AzCore/Component/Component.h"
+#include "AzCore/std/containers/span.h"
+#include "AzCore/std/containers/unordered_map.h"
+#include "AzCore/std/optional.h"
 
+#include "Conversation/AvailabilityBus.h"
 #include "Conversation/Components/DialogueComponentConfig.h"
 #include "Conversation/ConversationAsset.h"
 #include "Conversation/ConversationTypeIds.h"
 #include "Conversation/DialogueComponentBus.h"
 #include "Conversation/DialogueData.h"
 #include "Conversation/IConversationAsset.h"
+#include "ConversationNotificationQueue.h"
+#include "ConversationPreloader.h"
+#include "ConversationSession.h"
+#include "ConversationSessionPool.h"
+#include "DialogueScheduler.h"
+#include "MergedConversationIndex.h"
 
 namespace Conversation
 {
-    class ConversationAssetRefComponentRequests;
-
     // When given a list of responses to a dialogue, what number do we associate
     // with the first response?
     constexpr auto FirstResponseNumber = 1;
@@ -26,6 +35,10 @@ namespace Conversation
     class DialogueComponent
         : public AZ::Component
         , public DialogueComponentRequestBus::Handler
+        , public DialogueTimerNotificationBus::Handler
+        , public DialoguePreloadRequestBus::Handler
+        , public DialogueNotificationDispatchBus::Handler
+        , public AZ::Data::AssetBus::MultiHandler
     {
     public:
         AZ_COMPONENT(DialogueComponent, DialogueComponentTypeId);
@@ -65,32 +78,155 @@ namespace Conversation
         [[nodiscard]] auto GetActiveDialogue() const
             -> AZ::Outcome<DialogueData> override
         {
-            return m_activeDialogue ? *m_activeDialogue : DialogueData();
+            auto const* const session = FindSession();
+            return session && session->HasActiveDialogue()
+                ? session->GetActiveDialogue()
+                : DialogueData();
         }
 
         [[nodiscard]] auto GetAvailableResponses() const
-            -> AZStd::vector<DialogueData> override
-        {
-            return m_availableResponses;
-        }
+            -> AZStd::vector<DialogueData> override;
 
         [[nodiscard]] auto GetCurrentState() const -> DialogueState override
         {
-            return m_currentState;
+            auto const* const session = FindSession();
+            return session ? session->GetState() : DialogueState::Inactive;
         }
 
         [[nodiscard]] auto CheckAvailability(
             DialogueData const& dialogueData) const -> bool override;
         [[nodiscard]] auto CheckAvailabilityById(
             UniqueId const& dialogueIdToCheck) const -> bool override;
+        void AppendStartingDialogues(
+            AZStd::vector<DialogueView>& dialogues) const override;
+
+        void OnDelayElapsed() override;
+
+        [[nodiscard]] auto GetPreloadPosition() const -> AZ::Vector3 override;
+        [[nodiscard]] auto IsPreloaded() const -> bool override
+        {
+            return m_isPreloaded;
+        }
+        void Preload() override;
+        void ReleasePreload() override;
+        //! Queues a load of the asset and holds it until the preload ends.
+        void QueuePreload(AZ::Data::Asset<AZ::Data::AssetData> asset);
+        //! Reads ahead a ready asset's main script and starting text.
+        void PreloadConversationAsset(
+            AZ::Data::Asset<ConversationAsset> const& asset);
+
+        void DispatchNotification(
+            QueuedNotification const& notification) override;
+
+        //! Merges in, and resolves the audio triggers of, assets that weren't
+        //! ready yet when we were activated.
+        void OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
+
+        //! Rebuilds the merged index over every asset that can be read now.
+        void RebuildConversationIndex();
+
+        //! Tags the entity as being in a conversation, if the config asks for
+        //! it.
+        void MirrorConversationTags(bool involvesPlayer);
+        //! Takes the entity out of the active conversation registry and tags.
+        void ClearActiveConversation();
+
+        //! Sends a notification now, or queues it if the config asks for it.
+        void Notify(QueuedNotification const& notification);
+        /**
+         * @brief Sends a spoken dialogue out to our listeners.
+         *
+         * A queued line is sent as it was spoken. Otherwise nothing is sent
+         * unless the dialogue is still the active one.
+         */
+        void SendDialogue(QueuedNotification const& notification);
+        //! Sends a queued line, which may be from a finished conversation.
+        void SendSpokenDialogue(SpokenDialogue const& spoken);
+        //! Returns whether any listener still wants OnDialogue.
+        [[nodiscard]] auto IsOnDialogueWanted() const -> bool;
+
+        //! Returns the available responses of a dialogue, in order.
+        [[nodiscard]] auto FindAvailableResponses(
+            DialogueData const& dialogue) const
+            -> ConversationSession::ResponseHandles;
+
+        /**
+         * @brief Works out, one response per tick, what each of the active
+         *        dialogue's responses would lead to.
+         *
+         * Only runs if the config asks for it.
+         */
+        void StartSpeculation();
+        void SpeculateResponse(AZ::u32 serial, size_t responseIndex);
+        static void ReleaseHeldText(
+            AZStd::span<ConversationSession::HeldText const> text);
 
     protected:
+        //! Returns our session, or nullptr if we aren't in a conversation.
+        [[nodiscard]] auto FindSession() -> ConversationSession*
+        {
+            return ConversationSessionPool::Get().Find(m_sessionHandle);
+        }
+
+        [[nodiscard]] auto FindSession() const -> ConversationSession const*
+        {
+            return ConversationSessionPool::Get().Find(m_sessionHandle);
+        }
+
+        //! Lets go of any held text, then hands our session back to the pool.
+        void ReleaseSession();
+
+        /**
+         * @brief Makes a dialogue active, then speaks it.
+         *
+         * The dialogue is copied into the session, so it may be read straight
+         * out of an asset.
+         */
+        void MakeDialogueActive(DialogueData const& dialogue);
+
         /***********************************************************************
          * @brief Checks which of the active dialogue's responses are available
          *        and updates related data.
          **********************************************************************/
         void UpdateAvailableResponses();
 
+        /**
+         * @brief Checks up to MaxAvailabilityBatchSize dialogues with a single
+         *        call to the availability handlers.
+         *
+         * @returns A mask with bit i set if dialogues[i] is available.
+         */
+        [[nodiscard]] auto CheckAvailabilities(
+            AZStd::span<DialogueData const* const> dialogues) const
+            -> AvailabilityMask;
+
+        using AvailabilityCache = AZStd::unordered_map<AZ::u32, bool>;
+
+        /**
+         * @brief Returns the availability cache, emptied if the world state
+         *        epoch moved since it was filled.
+         *
+         * @returns nullptr if the config doesn't ask for caching, or there's
+         * no conversation system to get the epoch from. Nothing may be cached
+         * then.
+         */
+        [[nodiscard]] auto GetAvailabilityCache() const -> AvailabilityCache*;
+
+        /**
+         * @brief Returns the availability key our assets resolved for the
+         *        dialogue when they loaded.
+         *
+         * @returns nullopt if the dialogue isn't from one of our assets, or
+         * its asset has no resolved keys.
+         */
+        [[nodiscard]] auto FindAvailabilityKey(
+            DialogueData const& dialogueData) const
+            -> AZStd::optional<AZStd::string_view>;
+
+        //! Asks the availability handlers on our entity, skipping the cache.
+        [[nodiscard]] auto QueryAvailability(
+            DialogueData const& dialogueData) const -> bool;
+
         /***********************************************************************
          * @brief Executes the current conversation's companion script.
          **********************************************************************/
@@ -98,21 +234,79 @@ namespace Conversation
         void PlayDialogueAudio() const;
         void RunCinematic() const;
 
+        //! Speaks the active dialogue once its entry delay is over.
+        void EnterActiveDialogue();
+
+        /**
+         * @brief Sends out the active dialogue and runs everything tied to it.
+         *
+         * The dialogue is considered spoken after this call. If it has an
+         * exit delay, the conversation continues once the delay is over.
+         */
+        void SpeakActiveDialogue();
+
+        /**
+         * @brief Runs a step of the conversation after a delay.
+         *
+         * @returns False if there's no scheduler to wait with, in which case
+         * nothing was scheduled.
+         */
+        auto ScheduleDelayedStep(
+            ConversationSession& session,
+            ConversationSession::DelayedStep step,
+            float delaySeconds) -> bool;
+        void CancelDelayedStep(ConversationSession& session);
+
+        /**
+         * @brief Finds the streamed text the active dialogue and its responses
+         *        need, grouped by the asset it comes from.
+         */
+        [[nodiscard]] auto CollectStreamedText() const
+            -> ConversationSession::HeldTextContainer;
+
+        /**
+         * @brief Streams in the text of the active dialogue and its responses,
+         *        then speaks it.
+         *
+         * Text stores call back on the streamer's thread, so the rest of the
+         * selection is queued onto the main thread.
+         */
+        void LoadActiveDialogueText(
+            ConversationSession::HeldTextContainer text);
+        //! Fills in streamed text once it has loaded, then speaks.
+        void OnActiveDialogueTextLoaded();
+        //! Lets go of the streamed text held for the previous selection.
+        void ReleaseDialogueText();
+
         /**
          * Ends the conversation normally. Triggers end scripts.
          */
         void EndConversation();
 
     private:
-        ConversationAssetRefComponentRequests* m_conversationAssetRequests{};
+        // Every asset on our entity, in the order they're merged.
+        MergedConversationIndex::AssetContainer m_conversationAssets;
+        // The assets that were readable the last time they were merged.
+        MergedConversationIndex m_conversationIndex;
         DialogueComponentConfig m_config;
         ConversationAsset m_memoryConversationAsset;
-        DialogueState m_currentState = DialogueState::Inactive;
-        // The currently active dialogue, if there is one.
-        AZStd::optional<DialogueData> m_activeDialogue;
-        // Available responses to the active dialogue
-        AZStd::vector<DialogueData> m_availableResponses;
+        // The conversation we're in, if any. The pool owns its state.
+        ConversationSessionHandle m_sessionHandle;
         AZ::Data::AssetId m_dialogueAssetIds;
+        // Expires on deactivation, so queued text loads don't outlive us.
+        AZStd::shared_ptr<bool> m_aliveToken;
+        // Availability answers by availability ID, valid for one epoch.
+        mutable AvailabilityCache m_availabilityCache;
+        mutable AZ::u64 m_availabilityCacheEpoch{};
+        // Reused for the IDs of each batched availability check.
+        mutable AZStd::vector<AZStd::string> m_availabilityQuery;
+        // The companion script index of each ID in m_availabilityQuery.
+        mutable AZStd::vector<AZ::u32> m_availabilityScriptIndices;
+        // Held while the player is close, so starting a conversation doesn't
+        // have to wait on them.
+        AZStd::vector<AZ::Data::Asset<AZ::Data::AssetData>> m_preloadedAssets;
+        ConversationSession::HeldTextContainer m_preloadedText;
+        bool m_isPreloaded{};
     };
 
 } // namespace Conversation
@@ -0,0 +1,181 @@
+#include "Conversation/DialogueCondition.h"
+
+#include "AzCore/Debug/Trace.h"
+#include "AzCore/Serialization/SerializeContext.h"
+#include "AzCore/std/containers/array.h"
+
+namespace Conversation
+{
+    namespace
+    {
+        struct StackEffect
+        {
+            size_t m_pops;
+            size_t m_pushes;
+        };
+
+        constexpr auto GetStackEffect(ConditionOp op) -> StackEffect
+        {
+            switch (op)
+            {
+            case ConditionOp::PushInt:
+            case ConditionOp::PushUint:
+            case ConditionOp::PushFact:
+                return { 0, 1 };
+            case ConditionOp::Equal:
+            case ConditionOp::NotEqual:
+            case ConditionOp::And:
+            case ConditionOp::Or:
+                return { 2, 1 };
+            case ConditionOp::Not:
+                return { 1, 1 };
+            default:
+                return { 0, 0 };
+            }
+        }
+
+        /**
+         * Programs saved through the SerializeContext haven't been through
+         * SetCode, so they are validated once read in.
+         */
+        class DialogueConditionSerializationEvents
+            : public AZ::SerializeContext::IEventHandler
+        {
+        public:
+            void OnReadEnd(void* classPtr) override
+            {
+                auto* const condition =
+                    static_cast<DialogueCondition*>(classPtr);
+                if (!DialogueCondition::Validate(condition->GetCode()))
+                {
+                    AZ_Warning( // NOLINT
+                        "DialogueCondition",
+                        false,
+                        "Dropping a malformed dialogue condition.");
+                    condition->Clear();
+                }
+            }
+        };
+    } // namespace
+
+    void DialogueCondition::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext =
+                azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<ConditionInstruction>()
+                ->Version(0)
+                ->Field("Op", &ConditionInstruction::m_op)
+                ->Field("Operand", &ConditionInstruction::m_operand);
+
+            serializeContext->Class<DialogueCondition>()
+                ->Version(0)
+                ->EventHandler<DialogueConditionSerializationEvents>()
+                ->Field("Code", &DialogueCondition::m_code);
+        }
+    }
+
+    auto DialogueCondition::Validate(
+        AZStd::span<ConditionInstruction const> code) -> bool
+    {
+        size_t depth{};
+        for (ConditionInstruction const& instruction : code)
+        {
+            if (instruction.m_op >= ConditionOp::Count)
+            {
+                return false;
+            }
+
+            auto const [pops, pushes] = GetStackEffect(instruction.m_op);
+            if (depth < pops)
+            {
+                return false;
+            }
+
+            depth = depth - pops + pushes;
+            if (depth > MaxStackDepth)
+            {
+                return false;
+            }
+        }
+
+        return code.empty() || depth == 1;
+    }
+
+    auto DialogueCondition::SetCode(AZStd::vector<ConditionInstruction> code)
+        -> bool
+    {
+        if (!Validate(code))
+        {
+            m_code.clear();
+            return false;
+        }
+
+        m_code = AZStd::move(code);
+        return true;
+    }
+
+    auto DialogueCondition::Evaluate(ConditionFacts const* facts) const -> bool
+    {
+        if (m_code.empty())
+        {
+            return true;
+        }
+
+        AZStd::array<ConditionValue, MaxStackDepth> stack;
+        size_t depth{};
+
+        auto const pop = [&stack, &depth]() -> ConditionValue
+        {
+            return stack[--depth];
+        };
+        auto const push = [&stack, &depth](ConditionValue value)
+        {
+            stack[depth++] = value;
+        };
+
+        for (ConditionInstruction const& instruction : m_code)
+        {
+            switch (instruction.m_op)
+            {
+            case ConditionOp::PushInt:
+                push(static_cast<AZ::s32>(instruction.m_operand));
+                break;
+            case ConditionOp::PushUint:
+                push(instruction.m_operand);
+                break;
+            case ConditionOp::PushFact:
+                push(facts ? facts->GetFact(instruction.m_operand) : 0);
+                break;
+            case ConditionOp::Equal:
+                push(pop() == pop() ? 1 : 0);
+                break;
+            case ConditionOp::NotEqual:
+                push(pop() != pop() ? 1 : 0);
+                break;
+            case ConditionOp::And:
+            {
+                auto const rhs = pop();
+                auto const lhs = pop();
+                push(lhs != 0 && rhs != 0 ? 1 : 0);
+                break;
+            }
+            case ConditionOp::Or:
+            {
+                auto const rhs = pop();
+                auto const lhs = pop();
+                push(lhs != 0 || rhs != 0 ? 1 : 0);
+                break;
+            }
+            case ConditionOp::Not:
+                push(pop() == 0 ? 1 : 0);
+                break;
+            default:
+                AZ_Assert(false, "Condition was not validated."); // NOLINT
+                return false;
+            }
+        }
+
+        return stack[0] != 0;
+    }
+} // namespace Conversation
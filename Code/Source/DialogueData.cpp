@@ -11,6 +11,109 @@
 
 namespace Conversation
 {
+    namespace
+    {
+        /**
+         * Re-stores a field as a PooledString. The text itself is unchanged.
+         */
+        template<typename OldType>
+        auto ConvertToPooledString(
+            AZ::SerializeContext& context,
+            AZ::SerializeContext::DataElementNode& classElement,
+            char const* fieldName) -> bool
+        {
+            auto* const element =
+                classElement.FindSubElement(AZ::Crc32(fieldName));
+            if (!element)
+            {
+                return true;
+            }
+
+            OldType oldValue{};
+            if (!element->GetData(oldValue))
+            {
+                return false;
+            }
+
+            AZStd::string_view text{};
+            if constexpr (AZStd::is_same_v<OldType, AZ::Name>)
+            {
+                text = oldValue.GetStringView();
+            }
+            else
+            {
+                text = oldValue;
+            }
+
+            return element->Convert<PooledString>(context) &&
+                element->SetData(context, PooledString{ text });
+        }
+
+        /**
+         * Re-stores the dialogue's chunk as a reference into the
+         * DialogueChunkStore. The text itself is unchanged.
+         */
+        auto ConvertToDialogueChunkRef(
+            AZ::SerializeContext& context,
+            AZ::SerializeContext::DataElementNode& classElement) -> bool
+        {
+            auto* const element =
+                classElement.FindSubElement(AZ_CRC_CE("Chunk"));
+            if (!element)
+            {
+                return true;
+            }
+
+            AZStd::string text{};
+            element->FindSubElementAndGetData(AZ_CRC_CE("Data"), text);
+
+            DialogueChunk chunk{};
+            chunk.SetData(text);
+            return element->Convert<DialogueChunkRef>(context) &&
+                element->SetData(context, DialogueChunkRef{ chunk });
+        }
+
+        /**
+         * Version 9 moved the dialogue's text into the StringPool, and
+         * version 10 did the same for the cinematic ID. Version 11 moved the
+         * chunk into the DialogueChunkStore.
+         */
+        auto ConvertDialogueData(
+            AZ::SerializeContext& context,
+            AZ::SerializeContext::DataElementNode& classElement) -> bool
+        {
+            constexpr auto PooledTextVersion{ 9 };
+            constexpr auto PooledCinematicVersion{ 10 };
+            constexpr auto StoredChunkVersion{ 11 };
+
+            if (classElement.GetVersion() < PooledTextVersion)
+            {
+                for (auto const* const fieldName :
+                     { "ActorText", "Comment", "Speaker" })
+                {
+                    if (!ConvertToPooledString<AZStd::string>(
+                            context, classElement, fieldName))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            if (classElement.GetVersion() < PooledCinematicVersion &&
+                !ConvertToPooledString<AZ::Name>(
+                    context, classElement, "CinematicId"))
+            {
+                return false;
+            }
+
+            if (classElement.GetVersion() < StoredChunkVersion)
+            {
+                return ConvertToDialogueChunkRef(context, classElement);
+            }
+
+            return true;
+        }
+    } // namespace
 
     void ResponseData::Reflect(AZ::ReflectContext* context)
     {
@@ -27,21 +130,33 @@ namespace Conversation
     void DialogueData::Reflect(AZ::ReflectContext* context)
     {
         DialogueAudioControl::Reflect(context);
+        PooledString::Reflect(context);
+        DialogueChunkRef::Reflect(context);
+        DialogueCondition::Reflect(context);
         ResponseData::Reflect(context);
 
         if (auto* serializeContext =
                 azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<DialogueData>()
-                ->Version(8) // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+                ->Version( // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+                    14,
+                    &ConvertDialogueData)
                 ->Field("ActorText", &DialogueData::m_shortText)
                 ->Field("AvailabilityId", &DialogueData::m_availabilityId)
+                ->Field(
+                    "AvailabilityScriptIndex",
+                    &DialogueData::m_availabilityScriptIndex)
                 ->Field("AudioTrigger", &DialogueData::m_audioControl)
                 ->Field("CinematicId", &DialogueData::m_cinematicId)
                 ->Field("Comment", &DialogueData::m_comment)
+                ->Field("Condition", &DialogueData::m_condition)
                 ->Field("Chunk", &DialogueData::m_dialogueChunk)
                 ->Field("DialogueId", &DialogueData::m_id)
+                ->Field("EntryDelay", &DialogueData::m_entryDelay)
+                ->Field("ExitDelay", &DialogueData::m_exitDelay)
                 ->Field("ResponseIds", &DialogueData::m_responseIds)
+                ->Field("ScriptIndex", &DialogueData::m_scriptIndex)
                 ->Field("Speaker", &DialogueData::m_speaker);
 
             serializeContext->RegisterGenericType<DialogueDataPtr>();
@@ -87,6 +202,22 @@ namespace Conversation
                         "AvailabilityId",
                         "Id to be called when determining dialogue "
                         "availability.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &DialogueData::m_entryDelay,
+                        "Entry Delay",
+                        "Seconds to wait before the dialogue is spoken.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->Attribute(AZ::Edit::Attributes::Suffix, " s")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &DialogueData::m_exitDelay,
+                        "Exit Delay",
+                        "Seconds to wait after the dialogue is spoken before "
+                        "the conversation continues on its own. Zero waits "
+                        "for ContinueConversation.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->Attribute(AZ::Edit::Attributes::Suffix, " s")
                     ->DataElement(
                         AZ::Edit::UIHandlers::Button,
                         &DialogueData::m_id,
@@ -138,7 +269,15 @@ namespace Conversation
                 ->Property(
                     "CinematicId",
                     &DialogueData::GetCinematicId,
-                    &DialogueData::SetCinematicId);
+                    &DialogueData::SetCinematicId)
+                ->Property(
+                    "EntryDelay",
+                    &DialogueData::GetEntryDelay,
+                    &DialogueData::SetEntryDelay)
+                ->Property(
+                    "ExitDelay",
+                    &DialogueData::GetExitDelay,
+                    &DialogueData::SetExitDelay);
         }
     }
 
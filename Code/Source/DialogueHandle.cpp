@@ -0,0 +1,55 @@
+#include "Conversation/DialogueHandle.h"
+
+#include "AzCore/RTTI/BehaviorContext.h"
+#include "AzCore/Script/ScriptContextAttributes.h"
+#include "AzCore/Serialization/SerializeContext.h"
+
+#include "Conversation/Constants.h"
+#include "Conversation/ConversationAsset.h"
+
+namespace Conversation
+{
+    void DialogueHandle::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Class<DialogueHandle>("DialogueHandle")
+                ->Attribute(
+                    AZ::Script::Attributes::Category, DialogueSystemCategory)
+                ->Attribute(
+                    AZ::Script::Attributes::Module, DialogueSystemModule)
+                ->Attribute(
+                    AZ::Script::Attributes::Scope,
+                    AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::ConstructibleFromNil, true)
+                ->Attribute(
+                    AZ::Script::Attributes::Operator,
+                    AZ::Script::Attributes::OperatorType::Equal)
+                ->Constructor()
+                ->Method("IsValid", &DialogueHandle::IsValid)
+                ->Property("ID", &DialogueHandle::GetId, nullptr)
+                ->Property("Text", &DialogueHandle::GetShortText, nullptr)
+                ->Property("Speaker", &DialogueHandle::GetSpeaker, nullptr)
+                ->Property("ChunkText", &DialogueHandle::GetChunkText, nullptr)
+                ->Method("CountResponseIds", &DialogueHandle::CountResponseIds)
+                ->Method("GetResponseId", &DialogueHandle::GetResponseId)
+                ->Method("CopyDialogue", &DialogueHandle::CopyDialogue);
+        }
+    }
+
+    auto DialogueHandle::GetDialogue() const -> DialogueData const*
+    {
+        if (!IsValid() || m_index >= m_asset->CountDialogues())
+        {
+            return nullptr;
+        }
+
+        return &m_asset->GetDialogueByIndex(m_index);
+    }
+
+    auto DialogueHandle::GetChunkText() const -> AZStd::string_view
+    {
+        return IsValid() ? m_asset->GetChunkText(m_index)
+                         : AZStd::string_view{};
+    }
+} // namespace Conversation
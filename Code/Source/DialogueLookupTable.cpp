@@ -0,0 +1,159 @@
+#include "Conversation/DialogueLookupTable.h"
+
+#include "AzCore/std/algorithm.h"
+#include "AzCore/std/sort.h"
+
+namespace Conversation
+{
+    namespace
+    {
+        //! The average number of IDs per bucket. Larger buckets make the
+        //! table smaller but the build slower.
+        constexpr size_t IdsPerBucket{ 4 };
+        //! How many seeds are tried for a bucket before the build gives up.
+        constexpr AZ::u32 MaxSeed{ 1U << 24 };
+    } // namespace
+
+    auto DialogueLookupTable::Build(AZStd::span<AZ::u32 const> ids) -> bool
+    {
+        Clear();
+
+        if (ids.empty())
+        {
+            return true;
+        }
+
+        if (ids.size() >= InvalidDialogueIndex)
+        {
+            return false;
+        }
+
+        // Repeated IDs always collide, so they are rejected up front rather
+        // than by exhausting every seed.
+        AZStd::vector<AZ::u32> sortedIds(ids.begin(), ids.end());
+        AZStd::sort(sortedIds.begin(), sortedIds.end());
+        if (AZStd::adjacent_find(sortedIds.begin(), sortedIds.end()) !=
+            sortedIds.end())
+        {
+            return false;
+        }
+
+        size_t const slotCount = ids.size();
+        size_t const bucketCount =
+            (slotCount + IdsPerBucket - 1) / IdsPerBucket;
+
+        AZStd::vector<AZStd::vector<DialogueIndex>> buckets(bucketCount);
+        for (DialogueIndex index{}; index < slotCount; ++index)
+        {
+            buckets[Reduce(Hash(ids[index], 0), bucketCount)].push_back(index);
+        }
+
+        // The largest buckets are the hardest to place, so they go first
+        // while most slots are still free.
+        AZStd::vector<AZ::u32> bucketOrder(bucketCount);
+        for (AZ::u32 bucket{}; bucket < bucketCount; ++bucket)
+        {
+            bucketOrder[bucket] = bucket;
+        }
+        AZStd::stable_sort(
+            bucketOrder.begin(),
+            bucketOrder.end(),
+            [&buckets](AZ::u32 lhs, AZ::u32 rhs)
+            {
+                return buckets[lhs].size() > buckets[rhs].size();
+            });
+
+        AZStd::vector<AZ::u32> seeds(bucketCount, 0);
+        AZStd::vector<Slot> slots(slotCount, Slot{});
+        AZStd::vector<bool> isTaken(slotCount, false);
+        AZStd::vector<size_t> candidates;
+
+        for (AZ::u32 const bucket : bucketOrder)
+        {
+            auto const& bucketIndices = buckets[bucket];
+            if (bucketIndices.empty())
+            {
+                // Buckets are sorted by size, so the rest are empty too.
+                break;
+            }
+
+            bool isPlaced = false;
+            for (AZ::u32 seed{ 1 }; seed < MaxSeed && !isPlaced; ++seed)
+            {
+                candidates.clear();
+                for (DialogueIndex const index : bucketIndices)
+                {
+                    auto const slot = Reduce(Hash(ids[index], seed), slotCount);
+                    bool const isCandidate =
+                        AZStd::find(
+                            candidates.begin(), candidates.end(), slot) !=
+                        candidates.end();
+                    if (isTaken[slot] || isCandidate)
+                    {
+                        break;
+                    }
+                    candidates.push_back(slot);
+                }
+
+                if (candidates.size() != bucketIndices.size())
+                {
+                    continue;
+                }
+
+                for (size_t entry{}; entry < candidates.size(); ++entry)
+                {
+                    auto const index = bucketIndices[entry];
+                    isTaken[candidates[entry]] = true;
+                    slots[candidates[entry]] = Slot{ ids[index], index };
+                }
+
+                seeds[bucket] = seed;
+                isPlaced = true;
+            }
+
+            if (!isPlaced)
+            {
+                return false;
+            }
+        }
+
+        m_seeds = AZStd::move(seeds);
+        m_slots = AZStd::move(slots);
+        return true;
+    }
+
+    auto DialogueLookupTable::Assign(
+        AZStd::vector<AZ::u32> seeds,
+        AZStd::vector<Slot> slots,
+        AZStd::span<AZ::u32 const> ids) -> bool
+    {
+        Clear();
+
+        if (slots.size() != ids.size() || seeds.empty() != ids.empty())
+        {
+            return false;
+        }
+
+        m_seeds = AZStd::move(seeds);
+        m_slots = AZStd::move(slots);
+
+        // Each ID that finds its own index takes a different slot, so once
+        // every ID passes, no slot is left unchecked.
+        for (DialogueIndex index{}; index < ids.size(); ++index)
+        {
+            if (Find(UniqueId::CreateFromHash(ids[index])) != index)
+            {
+                Clear();
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void DialogueLookupTable::Clear()
+    {
+        m_seeds.clear();
+        m_slots.clear();
+    }
+} // namespace Conversation
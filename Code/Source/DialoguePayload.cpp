@@ -0,0 +1,37 @@
+#include "Conversation/DialoguePayload.h"
+
+#include "AzCore/RTTI/BehaviorContext.h"
+#include "AzCore/Script/ScriptContextAttributes.h"
+
+#include "Conversation/Constants.h"
+
+namespace Conversation
+{
+    void DialoguePayload::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Class<DialoguePayload>("DialoguePayload")
+                ->Attribute(
+                    AZ::Script::Attributes::Category, DialogueSystemCategory)
+                ->Attribute(
+                    AZ::Script::Attributes::Module, DialogueSystemModule)
+                ->Attribute(
+                    AZ::Script::Attributes::Scope,
+                    AZ::Script::Attributes::ScopeFlags::Common)
+                ->Method("IsValid", &DialoguePayload::IsValid)
+                ->Property("ID", &DialoguePayload::GetDialogueId, nullptr)
+                ->Property("Text", &DialoguePayload::GetShortText, nullptr)
+                ->Property("Speaker", &DialoguePayload::GetSpeaker, nullptr)
+                ->Property(
+                    "ChunkText", &DialoguePayload::GetChunkText, nullptr)
+                ->Method("CopyDialogue", &DialoguePayload::CopyDialogue)
+                ->Method("CountResponses", &DialoguePayload::CountResponses)
+                ->Method(
+                    "GetResponse",
+                    &DialoguePayload::GetResponse,
+                    { { { "ResponseIndex",
+                          "The position of the response, starting at 0." } } });
+        }
+    }
+} // namespace Conversation
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "AzCore/Component/ComponentBus.h"
+#include "AzCore/EBus/EBus.h"
+#include "AzCore/Interface/Interface.h"
+#include "AzCore/RTTI/RTTIMacros.h"
+
+#include "ConversationSessionPool.h"
+#include "TimerWheel.h"
+
+namespace Conversation
+{
+    /**
+     * @brief Runs the timers of every conversation from one place.
+     *
+     * Dialogue delays are scheduled here instead of each dialogue component
+     * ticking on its own. When a timer fires, the session's owner is told
+     * through the DialogueTimerNotificationBus.
+     */
+    class DialogueScheduler
+    {
+    public:
+        AZ_RTTI( // NOLINT
+            DialogueScheduler,
+            "{3E7A9C52-1D84-4B6F-A0E3-58C2F91D6B47}");
+        AZ_DISABLE_COPY_MOVE(DialogueScheduler); // NOLINT
+
+        DialogueScheduler() = default;
+        virtual ~DialogueScheduler() = default;
+
+        /**
+         * @brief Starts a timer for a session.
+         *
+         * The timer is only reported if, when it fires, the session still
+         * exists and still waits on it.
+         *
+         * @see ConversationSession::SetDelayedStep
+         */
+        virtual auto ScheduleSessionTimer(
+            ConversationSessionHandle session, float delaySeconds)
+            -> TimerWheel::Handle = 0;
+
+        virtual void CancelSessionTimer(TimerWheel::Handle timer) = 0;
+    };
+
+    using DialogueSchedulerInterface = AZ::Interface<DialogueScheduler>;
+
+    class DialogueTimerNotifications : public AZ::ComponentBus
+    {
+    public:
+        AZ_DISABLE_COPY_MOVE(DialogueTimerNotifications); // NOLINT
+
+        DialogueTimerNotifications() = default;
+        ~DialogueTimerNotifications() override = default;
+
+        //! The timer of the entity's delayed conversation step has fired.
+        virtual void OnDelayElapsed() = 0;
+    };
+
+    using DialogueTimerNotificationBus =
+        AZ::EBus<DialogueTimerNotifications>;
+} // namespace Conversation
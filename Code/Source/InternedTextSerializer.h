@@ -0,0 +1,74 @@
+#pragma once
+
+#include "AzCore/IO/GenericStreams.h"
+#include "AzCore/Serialization/SerializeContext.h"
+#include "AzCore/std/string/string.h"
+
+namespace Conversation
+{
+    /**
+     * @brief Saves a reference into an InternTable as its text.
+     *
+     * IDs are only meaningful to the process that assigned them, so saved
+     * data holds the text and is interned again when it's loaded.
+     *
+     * @tparam Traits Provides:
+     *  - Ref, the reference type.
+     *  - ToText(Ref) -> AZStd::string_view
+     *  - FromText(AZStd::string_view) -> Ref
+     */
+    template<typename Traits>
+    class InternedTextSerializer : public AZ::SerializeContext::IDataSerializer
+    {
+    public:
+        using Ref = typename Traits::Ref;
+
+        auto Save(
+            void const* classPtr,
+            AZ::IO::GenericStream& stream,
+            [[maybe_unused]] bool isDataBigEndian) -> size_t override
+        {
+            auto const text =
+                Traits::ToText(*static_cast<Ref const*>(classPtr));
+            return static_cast<size_t>(stream.Write(text.size(), text.data()));
+        }
+
+        auto DataToText(
+            AZ::IO::GenericStream& in,
+            AZ::IO::GenericStream& out,
+            [[maybe_unused]] bool isDataBigEndian) -> size_t override
+        {
+            AZStd::string text(in.GetLength(), '\0');
+            in.Read(text.size(), text.data());
+            return static_cast<size_t>(out.Write(text.size(), text.data()));
+        }
+
+        auto TextToData(
+            char const* text,
+            [[maybe_unused]] unsigned int textVersion,
+            AZ::IO::GenericStream& stream,
+            [[maybe_unused]] bool isDataBigEndian) -> size_t override
+        {
+            return static_cast<size_t>(stream.Write(strlen(text), text));
+        }
+
+        auto Load(
+            void* classPtr,
+            AZ::IO::GenericStream& stream,
+            [[maybe_unused]] unsigned int version,
+            [[maybe_unused]] bool isDataBigEndian) -> bool override
+        {
+            AZStd::string text(stream.GetLength(), '\0');
+            stream.Read(text.size(), text.data());
+            *static_cast<Ref*>(classPtr) = Traits::FromText(text);
+            return true;
+        }
+
+        auto CompareValueData(void const* lhs, void const* rhs)
+            -> bool override
+        {
+            return AZ::SerializeContext::EqualityCompareHelper<
+                Ref>::CompareValues(lhs, rhs);
+        }
+    };
+} // namespace Conversation
@@ -0,0 +1,115 @@
+#include "MergedConversationIndex.h"
+
+#include "AzCore/Debug/Trace.h"
+#include "AzCore/std/containers/unordered_set.h"
+
+namespace Conversation
+{
+    void MergedConversationIndex::Build(AssetContainer assets)
+    {
+        Clear();
+
+        AZStd::vector<AZ::u32> ids;
+        AZStd::unordered_set<UniqueId> seenIds;
+        AZStd::unordered_set<UniqueId> seenStartingIds;
+
+        for (auto& asset : assets)
+        {
+            if (!asset)
+            {
+                continue;
+            }
+
+            ConversationAsset const* const conversationAsset = asset.Get();
+            auto const dialogueCount =
+                static_cast<DialogueIndex>(conversationAsset->CountDialogues());
+            for (DialogueIndex index{}; index < dialogueCount; ++index)
+            {
+                auto const id =
+                    conversationAsset->GetDialogueByIndex(index).GetId();
+                if (!seenIds.insert(id).second)
+                {
+                    AZ_Warning( // NOLINT
+                        "MergedConversationIndex",
+                        false,
+                        "Dialogue ID '%u' in '%s' is already used by an "
+                        "earlier asset. Only the first one will be used.",
+                        id.GetHash(),
+                        asset.GetHint().c_str());
+                    continue;
+                }
+
+                m_dialogues.emplace_back(conversationAsset, index);
+                ids.push_back(id.GetHash());
+            }
+
+            for (UniqueId const& startingId :
+                 conversationAsset->GetStartingIds())
+            {
+                if (seenStartingIds.insert(startingId).second)
+                {
+                    m_startingIds.push_back(startingId);
+                }
+            }
+
+            m_assets.push_back(AZStd::move(asset));
+        }
+
+        // The IDs were deduplicated above, so this can only fail if no seeds
+        // were found, which is practically impossible.
+        if (!m_lookup.Build(ids))
+        {
+            AZ_Error( // NOLINT
+                "MergedConversationIndex",
+                false,
+                "Unable to build the dialogue index.");
+            Clear();
+            return;
+        }
+
+        // Responses are resolved through the merged index so that they can
+        // refer to dialogues in other assets.
+        m_responseOffsets.reserve(m_dialogues.size() + 1);
+        for (DialogueHandle const& dialogue : m_dialogues)
+        {
+            m_responseOffsets.push_back(
+                static_cast<AZ::u32>(m_responses.size()));
+
+            for (UniqueId const& responseId :
+                 dialogue.GetView().GetResponseIds())
+            {
+                if (auto const response = GetDialogueHandle(responseId);
+                    response.IsValid())
+                {
+                    m_responses.push_back(response);
+                }
+            }
+        }
+        m_responseOffsets.push_back(static_cast<AZ::u32>(m_responses.size()));
+    }
+
+    void MergedConversationIndex::Clear()
+    {
+        m_assets.clear();
+        m_startingIds.clear();
+        m_dialogues.clear();
+        m_lookup.Clear();
+        m_responseOffsets.clear();
+        m_responses.clear();
+    }
+
+    auto MergedConversationIndex::GetResponseHandles(
+        UniqueId const& dialogueId) const -> AZStd::span<DialogueHandle const>
+    {
+        auto const index = m_lookup.Find(dialogueId);
+        if (index == InvalidDialogueIndex)
+        {
+            return {};
+        }
+
+        auto const begin = m_responseOffsets[index];
+        auto const end = m_responseOffsets[index + 1];
+        return AZStd::span<DialogueHandle const>{ m_responses }.subspan(
+            begin, end - begin);
+    }
+} // namespace Conversation
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "AzCore/Asset/AssetCommon.h"
+#include "AzCore/std/containers/span.h"
+#include "AzCore/std/containers/vector.h"
+
+#include "Conversation/ConversationAsset.h"
+#include "Conversation/DialogueHandle.h"
+#include "Conversation/DialogueLookupTable.h"
+#include "Conversation/UniqueId.h"
+
+namespace Conversation
+{
+    /**
+     * @brief One lookup index over several conversation assets.
+     *
+     * An entity can carry a base asset plus any number of additional ones,
+     * such as DLC. The index is built when the dialogue component activates,
+     * and again whenever one of its assets finishes loading. Every lookup is
+     * a single perfect hash probe no matter how many assets there are.
+     *
+     * Assets are merged in order. If a dialogue ID appears in more than one
+     * asset, the first asset's dialogue is used. Responses are resolved
+     * across assets, so one asset can answer another asset's dialogue.
+     */
+    class MergedConversationIndex
+    {
+    public:
+        using AssetContainer =
+            AZStd::vector<AZ::Data::Asset<ConversationAsset>>;
+
+        //! Rebuilds the index over the given assets.
+        void Build(AssetContainer assets);
+        void Clear();
+
+        [[nodiscard]] auto HasAssets() const -> bool
+        {
+            return !m_assets.empty();
+        }
+
+        [[nodiscard]] auto GetAssets() const
+            -> AZStd::span<AZ::Data::Asset<ConversationAsset> const>
+        {
+            return m_assets;
+        }
+
+        [[nodiscard]] auto CountDialogues() const -> size_t
+        {
+            return m_dialogues.size();
+        }
+
+        [[nodiscard]] auto CountStartingIds() const -> size_t
+        {
+            return m_startingIds.size();
+        }
+
+        //! Returns the starting IDs of every asset, without repeats.
+        [[nodiscard]] auto GetStartingIds() const
+            -> AZStd::span<UniqueId const>
+        {
+            return m_startingIds;
+        }
+
+        [[nodiscard]] auto GetDialogueHandle(UniqueId const& dialogueId) const
+            -> DialogueHandle
+        {
+            auto const index = m_lookup.Find(dialogueId);
+            return index != InvalidDialogueIndex ? m_dialogues[index]
+                                                 : DialogueHandle{};
+        }
+
+        /**
+         * @brief Returns the responses of a dialogue, from any asset.
+         *
+         * @returns The responses in the order the dialogue lists them, or an
+         * empty span if the dialogue isn't in the index.
+         */
+        [[nodiscard]] auto GetResponseHandles(UniqueId const& dialogueId) const
+            -> AZStd::span<DialogueHandle const>;
+
+    private:
+        AssetContainer m_assets;
+        AZStd::vector<UniqueId> m_startingIds;
+        //! Every dialogue of every asset, by merged index.
+        AZStd::vector<DialogueHandle> m_dialogues;
+        //! Maps a dialogue ID to its merged index.
+        DialogueLookupTable m_lookup;
+        //! Where each merged dialogue's responses begin in m_responses.
+        AZStd::vector<AZ::u32> m_responseOffsets;
+        AZStd::vector<DialogueHandle> m_responses;
+    };
+} // namespace Conversation
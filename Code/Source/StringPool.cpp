@@ -0,0 +1,49 @@
+#include "Conversation/StringPool.h"
+
+#include "AzCore/Module/Environment.h"
+#include "AzCore/Serialization/SerializeContext.h"
+
+#include "InternedTextSerializer.h"
+
+namespace Conversation
+{
+    namespace
+    {
+        constexpr auto StringPoolEnvironmentName = "ConversationStringPool";
+
+        struct PooledStringText
+        {
+            using Ref = PooledString;
+
+            static auto ToText(PooledString const& string)
+                -> AZStd::string_view
+            {
+                return string.GetStringView();
+            }
+
+            static auto FromText(AZStd::string_view text) -> PooledString
+            {
+                return PooledString{ text };
+            }
+        };
+    } // namespace
+
+    auto StringPool::Get() -> StringPool&
+    {
+        static AZ::EnvironmentVariable<StringPool> pool =
+            AZ::Environment::CreateVariable<StringPool>(
+                StringPoolEnvironmentName);
+        return *pool;
+    }
+
+    void PooledString::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext =
+                azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<PooledString>()
+                ->Version(0)
+                ->Serializer<InternedTextSerializer<PooledStringText>>();
+        }
+    }
+} // namespace Conversation
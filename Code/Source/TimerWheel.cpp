@@ -0,0 +1,137 @@
+#include "TimerWheel.h"
+
+#include "AzCore/std/algorithm.h"
+#include "AzCore/std/utils.h"
+
+namespace Conversation
+{
+    TimerWheel::TimerWheel()
+    {
+        m_slots.fill(InvalidNode);
+    }
+
+    auto TimerWheel::Schedule(AZ::u64 delay, AZ::u64 payload) -> Handle
+    {
+        AZ::u32 node{};
+        if (m_freeNodes.empty())
+        {
+            node = static_cast<AZ::u32>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+        else
+        {
+            node = m_freeNodes.back();
+            m_freeNodes.pop_back();
+        }
+
+        // The current tick has already been visited, so the earliest a timer
+        // can fire is the next one.
+        m_nodes[node].m_expiry =
+            m_now + AZStd::clamp(delay, AZ::u64{ 1 }, MaxDelay);
+        m_nodes[node].m_payload = payload;
+        Insert(node);
+        ++m_timerCount;
+
+        return Handle{ node, m_nodes[node].m_generation };
+    }
+
+    void TimerWheel::Cancel(Handle handle)
+    {
+        if (IsScheduled(handle))
+        {
+            Unlink(handle.m_index);
+            Free(handle.m_index);
+        }
+    }
+
+    auto TimerWheel::IsScheduled(Handle handle) const -> bool
+    {
+        return handle.IsValid() && handle.m_index < m_nodes.size() &&
+            m_nodes[handle.m_index].m_generation == handle.m_generation &&
+            m_nodes[handle.m_index].m_slot != InvalidNode;
+    }
+
+    void TimerWheel::Insert(AZ::u32 node)
+    {
+        Node& timer = m_nodes[node];
+        auto const delay = timer.m_expiry - m_now;
+
+        // Each level spans SlotsPerLevel times the ticks of the one below.
+        size_t level{};
+        while (level + 1 < LevelCount &&
+               delay >= (AZ::u64{ 1 } << (SlotBits * (level + 1))))
+        {
+            ++level;
+        }
+
+        auto const slot = static_cast<AZ::u32>(
+            level * SlotsPerLevel +
+            ((timer.m_expiry >> (SlotBits * level)) & SlotMask));
+
+        timer.m_slot = slot;
+        timer.m_previous = InvalidNode;
+        timer.m_next = m_slots[slot];
+        if (timer.m_next != InvalidNode)
+        {
+            m_nodes[timer.m_next].m_previous = node;
+        }
+        m_slots[slot] = node;
+    }
+
+    void TimerWheel::Unlink(AZ::u32 node)
+    {
+        Node& timer = m_nodes[node];
+        if (timer.m_previous != InvalidNode)
+        {
+            m_nodes[timer.m_previous].m_next = timer.m_next;
+        }
+        else
+        {
+            m_slots[timer.m_slot] = timer.m_next;
+        }
+
+        if (timer.m_next != InvalidNode)
+        {
+            m_nodes[timer.m_next].m_previous = timer.m_previous;
+        }
+
+        timer.m_slot = InvalidNode;
+        timer.m_previous = InvalidNode;
+        timer.m_next = InvalidNode;
+    }
+
+    void TimerWheel::Free(AZ::u32 node)
+    {
+        // Outstanding handles to the node go stale.
+        ++m_nodes[node].m_generation;
+        m_freeNodes.push_back(node);
+        --m_timerCount;
+    }
+
+    void TimerWheel::Cascade()
+    {
+        // A level's next slot comes up each time every level below it has
+        // gone all the way around. Lower levels go first, so the timers moved
+        // down from a higher level never land in a slot that was just passed.
+        for (size_t level{ 1 }; level < LevelCount; ++level)
+        {
+            auto const levelMask = (AZ::u64{ 1 } << (SlotBits * level)) - 1;
+            if ((m_now & levelMask) != 0)
+            {
+                break;
+            }
+
+            auto const slot = static_cast<AZ::u32>(
+                level * SlotsPerLevel +
+                ((m_now >> (SlotBits * level)) & SlotMask));
+
+            auto node = AZStd::exchange(m_slots[slot], InvalidNode);
+            while (node != InvalidNode)
+            {
+                auto const next = m_nodes[node].m_next;
+                Insert(node);
+                node = next;
+            }
+        }
+    }
+} // namespace Conversation
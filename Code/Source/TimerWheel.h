@@ -0,0 +1,153 @@
+#pragma once
+
+#include "AzCore/base.h"
+#include "AzCore/std/containers/array.h"
+#include "AzCore/std/containers/vector.h"
+#include "AzCore/std/limits.h"
+
+namespace Conversation
+{
+    /**
+     * @brief A hierarchical timer wheel.
+     *
+     * Timers are bucketed by how far away they are: each level has 64 slots,
+     * and each slot of a level spans a whole turn of the level below it. When
+     * a lower level comes around, the next slot of the level above is
+     * redistributed downwards. Scheduling and cancelling are O(1), and
+     * advancing costs one slot visit per tick plus each timer's share of the
+     * redistribution.
+     *
+     * Timers are kept in one node pool and linked into their slot by index, so
+     * scheduling only allocates when the pool grows.
+     */
+    class TimerWheel
+    {
+    public:
+        static constexpr size_t SlotBits{ 6 };
+        static constexpr size_t SlotsPerLevel{ 1 << SlotBits };
+        static constexpr size_t LevelCount{ 4 };
+        //! Longer delays are clamped to this many ticks.
+        static constexpr AZ::u64 MaxDelay{
+            (AZ::u64{ 1 } << (SlotBits * LevelCount)) - 1
+        };
+
+        //! Refers to a scheduled timer. It goes stale once the timer fires or
+        //! is cancelled.
+        struct Handle
+        {
+            static constexpr AZ::u32 InvalidIndex{
+                AZStd::numeric_limits<AZ::u32>::max()
+            };
+
+            [[nodiscard]] auto IsValid() const -> bool
+            {
+                return m_index != InvalidIndex;
+            }
+
+            [[nodiscard]] auto operator==(Handle const& other) const -> bool
+            {
+                return m_index == other.m_index &&
+                    m_generation == other.m_generation;
+            }
+
+            [[nodiscard]] auto operator!=(Handle const& other) const -> bool
+            {
+                return !(*this == other);
+            }
+
+            AZ::u32 m_index{ InvalidIndex };
+            AZ::u32 m_generation{};
+        };
+
+        TimerWheel();
+
+        /**
+         * @brief Schedules a timer.
+         *
+         * @param delay Ticks until the timer fires. A timer always waits at
+         * least one tick.
+         * @param payload Handed back when the timer fires.
+         */
+        auto Schedule(AZ::u64 delay, AZ::u64 payload) -> Handle;
+
+        //! Does nothing if the timer already fired or was cancelled.
+        void Cancel(Handle handle);
+
+        [[nodiscard]] auto IsScheduled(Handle handle) const -> bool;
+
+        [[nodiscard]] auto CountTimers() const -> size_t
+        {
+            return m_timerCount;
+        }
+
+        //! Returns the number of ticks the wheel has advanced.
+        [[nodiscard]] auto GetTime() const -> AZ::u64
+        {
+            return m_now;
+        }
+
+        /**
+         * @brief Moves time forward, firing every timer that comes due.
+         *
+         * @param onExpired Called with the handle and payload of each timer
+         * that fires. It may schedule and cancel timers.
+         */
+        template<typename OnExpired>
+        void Advance(AZ::u64 ticks, OnExpired&& onExpired)
+        {
+            // Nothing can fire, so there's no need to visit each slot.
+            if (m_timerCount == 0)
+            {
+                m_now += ticks;
+                return;
+            }
+
+            for (AZ::u64 tick{}; tick < ticks; ++tick)
+            {
+                ++m_now;
+                Cascade();
+
+                // Level 0 comes first, so its slots are numbered from 0.
+                auto const& head = m_slots[m_now & SlotMask];
+                while (head != InvalidNode)
+                {
+                    auto const node = head;
+                    Handle const timer{ node, m_nodes[node].m_generation };
+                    auto const payload = m_nodes[node].m_payload;
+                    Unlink(node);
+                    Free(node);
+                    onExpired(timer, payload);
+                }
+            }
+        }
+
+    private:
+        static constexpr AZ::u32 InvalidNode{ Handle::InvalidIndex };
+        static constexpr AZ::u64 SlotMask{ SlotsPerLevel - 1 };
+
+        struct Node
+        {
+            AZ::u64 m_expiry{};
+            AZ::u64 m_payload{};
+            AZ::u32 m_previous{ InvalidNode };
+            AZ::u32 m_next{ InvalidNode };
+            AZ::u32 m_generation{};
+            //! The slot the node is linked into, or InvalidNode if it's free.
+            AZ::u32 m_slot{ InvalidNode };
+        };
+
+        //! Links the node into the slot its expiry falls in.
+        void Insert(AZ::u32 node);
+        void Unlink(AZ::u32 node);
+        void Free(AZ::u32 node);
+        //! Moves timers down from the levels whose next slot has come up.
+        void Cascade();
+
+        //! The head node of each slot, level by level.
+        AZStd::array<AZ::u32, SlotsPerLevel * LevelCount> m_slots;
+        AZStd::vector<Node> m_nodes;
+        AZStd::vector<AZ::u32> m_freeNodes;
+        AZ::u64 m_now{};
+        size_t m_timerCount{};
+    };
+} // namespace Conversation
@@ -1,22 +1,38 @@
+#include "ActiveConversationRegistry.h"
 #include "AzCore/Asset/AssetCommon.h"
 #include "AzCore/Asset/AssetManager.h"
 #include "AzCore/Component/Component.h"
 #include "AzCore/Component/Entity.h"
+#include "AzCore/IO/ByteContainerStream.h"
 #include "AzCore/RTTI/RTTIMacros.h"
 #include "AzCore/std/algorithm.h"
 #include "AzCore/std/ranges/ranges_algorithm.h"
 #include "AzTest/AzTest.h"
 #include "Components/ConversationAssetRefComponent.h"
+#include "Conversation/AvailabilityBus.h"
 #include "Conversation/Components/ConversationAssetRefComponentBus.h"
 #include "Conversation/Components/DialogueComponentConfig.h"
 #include "Conversation/ConversationAsset.h"
+#include "Conversation/ConversationAssetFormat.h"
+#include "Conversation/ConversationBus.h"
 #include "Conversation/ConversationTypeIds.h"
+#include "Conversation/DialogueChunk.h"
+#include "Conversation/DialogueChunkStore.h"
 #include "Conversation/DialogueComponentBus.h"
+#include "Conversation/DialogueCondition.h"
 #include "Conversation/DialogueData.h"
+#include "Conversation/DialogueLookupTable.h"
+#include "Conversation/DialoguePayload.h"
 #include "Conversation/UniqueId.h"
+#include "ConversationNotificationQueue.h"
+#include "ConversationPreloader.h"
+#include "ConversationSession.h"
+#include "ConversationSessionPool.h"
 #include "ConversationTestEnvironment.h"
 #include "DialogueComponent.h"
 #include "DialogueComponentTestBase.h"
+#include "MergedConversationIndex.h"
+#include "TimerWheel.h"
 
 namespace ConversationTest
 {
@@ -162,6 +178,153 @@ namespace ConversationTest
             }));
     }
 
+    TEST(StringPoolTests, SameText_Interned_SharesOneId)
+    {
+        using namespace Conversation;
+
+        auto& pool = StringPool::Get();
+        auto const id = pool.Intern("StringPoolTests_Speaker");
+        auto const count = pool.Count();
+
+        EXPECT_EQ(pool.Intern("StringPoolTests_Speaker"), id);
+        EXPECT_EQ(pool.Count(), count);
+        EXPECT_EQ(pool.Resolve(id), "StringPoolTests_Speaker");
+        EXPECT_EQ(pool.Intern(""), EmptyPooledStringId);
+
+        pool.Release(id);
+        pool.Release(id);
+        EXPECT_EQ(pool.Count(), count - 1);
+    }
+
+    TEST(StringPoolTests, LastPooledString_Destroyed_ReleasesText)
+    {
+        using namespace Conversation;
+
+        auto const& pool = StringPool::Get();
+        auto const count = pool.Count();
+
+        {
+            PooledString const first{ "StringPoolTests_Unloaded" };
+            PooledString second{ first };
+            PooledString const third{ AZStd::move(second) };
+
+            EXPECT_EQ(first, third);
+            EXPECT_TRUE(second.IsEmpty());
+            EXPECT_EQ(pool.Count(), count + 1);
+        }
+
+        // The text is dropped once no dialogue refers to it.
+        EXPECT_EQ(pool.Count(), count);
+    }
+
+    TEST(DialogueDataTests, SameSpeaker_SetSpeaker_TextIsPooled)
+    {
+        using namespace Conversation;
+
+        DialogueData first{ UniqueId::CreateRandomId() };
+        DialogueData second{ UniqueId::CreateRandomId() };
+        first.SetSpeaker("owner");
+        second.SetSpeaker(AZStd::string{ "owner" });
+
+        EXPECT_EQ(first.GetSpeaker(), "owner");
+        EXPECT_EQ(first.GetSpeaker().data(), second.GetSpeaker().data());
+        EXPECT_TRUE(DialogueData{}.GetShortText().empty());
+    }
+
+    TEST(DialogueChunkStoreTests, SameChunk_SetOnTwoDialogues_SharesOneId)
+    {
+        using namespace Conversation;
+
+        auto const& store = DialogueChunkStore::Get();
+        auto const count = store.Count();
+
+        DialogueChunk chunk{};
+        chunk.SetData("DialogueChunkStoreTests_Goodbye");
+        DialogueChunk sameChunk{};
+        sameChunk.SetData(AZStd::string{ "DialogueChunkStoreTests_Goodbye" });
+        EXPECT_EQ(chunk.GetHash(), sameChunk.GetHash());
+        EXPECT_EQ(chunk, sameChunk);
+
+        {
+            DialogueData first{ UniqueId::CreateRandomId() };
+            DialogueData second{ UniqueId::CreateRandomId() };
+            first.SetChunk(chunk);
+            second.SetChunk(sameChunk);
+
+            EXPECT_EQ(first.GetChunkRef(), second.GetChunkRef());
+            EXPECT_EQ(first.GetChunkAsText(), chunk.GetData());
+            EXPECT_EQ(store.Count(), count + 1);
+        }
+
+        // The chunk is dropped once no dialogue refers to it.
+        EXPECT_EQ(store.Count(), count);
+    }
+
+    TEST(DialogueLookupTableTests, ManyIds_Build_FindsEveryIndex)
+    {
+        using namespace Conversation;
+
+        constexpr AZ::u32 IdCount{ 1000 };
+        AZStd::vector<AZ::u32> ids;
+        ids.reserve(IdCount);
+        for (AZ::u32 index{}; index < IdCount; ++index)
+        {
+            ids.push_back(UniqueId::CreateNamedId(
+                              AZStd::string::format("Dialogue%u", index))
+                              .GetHash());
+        }
+
+        DialogueLookupTable table{};
+        ASSERT_TRUE(table.Build(ids));
+        EXPECT_EQ(table.GetSlots().size(), IdCount);
+
+        for (DialogueIndex index{}; index < IdCount; ++index)
+        {
+            EXPECT_EQ(table.Find(UniqueId::CreateFromHash(ids[index])), index);
+        }
+
+        auto const unknownId = UniqueId::CreateNamedId("NotInTheTable");
+        EXPECT_EQ(table.Find(unknownId), InvalidDialogueIndex);
+
+        ids.push_back(ids.front());
+        EXPECT_FALSE(table.Build(ids));
+        EXPECT_TRUE(table.IsEmpty());
+    }
+
+    TEST(DialogueConditionTests, FactComparison_Evaluate_ReadsFacts)
+    {
+        using namespace Conversation;
+
+        class TestFacts : public ConditionFacts
+        {
+        public:
+            auto GetFact(AZ::u32 factId) const -> ConditionValue override
+            {
+                return factId == 7 ? -3 : 0;
+            }
+        };
+
+        // fact(7) == -3 and not fact(8)
+        DialogueCondition condition;
+        ASSERT_TRUE(condition.SetCode({ { ConditionOp::PushFact, 7 },
+                                        { ConditionOp::PushInt,
+                                          static_cast<AZ::u32>(-3) },
+                                        { ConditionOp::Equal, 0 },
+                                        { ConditionOp::PushFact, 8 },
+                                        { ConditionOp::Not, 0 },
+                                        { ConditionOp::And, 0 } }));
+
+        TestFacts const facts;
+        EXPECT_TRUE(condition.Evaluate(&facts));
+        EXPECT_FALSE(condition.Evaluate(nullptr));
+
+        // A program that pops more than it pushed is rejected.
+        EXPECT_FALSE(condition.SetCode({ { ConditionOp::PushUint, 1 },
+                                         { ConditionOp::And, 0 } }));
+        EXPECT_TRUE(condition.IsEmpty());
+        EXPECT_TRUE(condition.Evaluate(nullptr));
+    }
+
     TEST(ConversationAssetTests, Defaulted_AddInvalidStartingId_IsRejected)
     {
         Conversation::ConversationAsset asset{};
@@ -209,6 +372,727 @@ namespace ConversationTest
         EXPECT_EQ(asset.CountDialogues(), 2);
     }
 
+    TEST(ConversationAssetTests, HasDialogue_FindDialogue_ReturnsMatch)
+    {
+        using namespace Conversation;
+
+        ConversationAsset asset{};
+
+        DialogueData const dlg1{ UniqueId::CreateRandomId() };
+        DialogueData const dlg2{ UniqueId::CreateRandomId() };
+
+        asset.AddDialogue(dlg1);
+        asset.AddDialogue(dlg2);
+
+        auto const* const found = asset.FindDialogue(dlg2.GetId());
+        ASSERT_NE(found, nullptr);
+        EXPECT_EQ(found->GetId(), dlg2.GetId());
+        EXPECT_EQ(
+            asset.GetDialogueByIndex(asset.GetDialogueIndex(dlg1.GetId())),
+            dlg1);
+        EXPECT_EQ(asset.FindDialogue(UniqueId::CreateRandomId()), nullptr);
+        EXPECT_EQ(
+            asset.GetDialogueIndex(UniqueId::CreateRandomId()),
+            InvalidDialogueIndex);
+    }
+
+    TEST(ConversationAssetTests, HasDialogue_AddDuplicateDialogue_IsRejected)
+    {
+        using namespace Conversation;
+
+        ConversationAsset asset{};
+
+        DialogueData const dlg{ UniqueId::CreateRandomId() };
+
+        asset.AddDialogue(dlg);
+        asset.AddDialogue(dlg);
+
+        EXPECT_EQ(asset.CountDialogues(), 1);
+    }
+
+    TEST(
+        ConversationAssetTests,
+        HasParentDialogue_AddResponse_ParentHasResponse)
+    {
+        using namespace Conversation;
+
+        ConversationAsset asset{};
+
+        DialogueData const parent{ UniqueId::CreateRandomId() };
+        DialogueData const response{ UniqueId::CreateRandomId() };
+
+        asset.AddDialogue(parent);
+        asset.AddDialogue(response);
+        asset.AddResponse({ parent.GetId(), response.GetId() });
+
+        auto const* const found = asset.FindDialogue(parent.GetId());
+        ASSERT_NE(found, nullptr);
+        ASSERT_EQ(found->CountResponseIds(), 1);
+        EXPECT_EQ(found->GetResponseIds().front(), response.GetId());
+    }
+
+    TEST(ConversationAssetTests, HasDialogue_GetDialogueHandle_ViewsInPlace)
+    {
+        using namespace Conversation;
+
+        ConversationAsset asset{};
+
+        DialogueData dlg{ UniqueId::CreateRandomId() };
+        dlg.SetShortText("Hello there.");
+        asset.AddDialogue(dlg);
+        asset.AddStartingId(dlg.GetId());
+
+        ASSERT_EQ(asset.GetStartingIds().size(), 1);
+        EXPECT_EQ(asset.GetStartingIds().front(), dlg.GetId());
+
+        auto const handle = asset.GetDialogueHandle(dlg.GetId());
+        ASSERT_TRUE(handle.IsValid());
+        EXPECT_EQ(handle.GetDialogue(), &asset.GetDialogues().front());
+        EXPECT_EQ(handle.GetShortText(), "Hello there.");
+
+        EXPECT_FALSE(
+            asset.GetDialogueHandle(UniqueId::CreateRandomId()).IsValid());
+    }
+
+    TEST(ConversationAssetTests, HasAudio_ResolveAudioTriggers_ReportsMissing)
+    {
+        using namespace Conversation;
+
+        ConversationAsset asset{};
+
+        DialogueData known{ UniqueId::CreateRandomId() };
+        known.SetAudioControl(DialogueAudioControl{ "Play_Known" });
+        DialogueData unknown{ UniqueId::CreateRandomId() };
+        unknown.SetAudioControl(DialogueAudioControl{ "Play_Unknown" });
+        DialogueData silent{ UniqueId::CreateRandomId() };
+        asset.AddDialogue(known);
+        asset.AddDialogue(unknown);
+        asset.AddDialogue(silent);
+
+        size_t resolveCount{};
+        auto const missing = asset.ResolveAudioTriggers(
+            [&resolveCount](DialogueAudioControl const& control) -> AZ::u64
+            {
+                ++resolveCount;
+                return control.GetName() == "Play_Known"
+                    ? 42
+                    : ConversationAsset::NoAudioTrigger;
+            });
+
+        // Dialogues without a control aren't looked up, or reported.
+        EXPECT_EQ(resolveCount, 2);
+        ASSERT_EQ(missing.size(), 1);
+        EXPECT_EQ(missing.front(), 1);
+        ASSERT_TRUE(asset.HasAudioTriggerIds());
+        EXPECT_EQ(asset.GetAudioTriggerId(0), 42);
+        EXPECT_EQ(
+            asset.GetAudioTriggerId(1), ConversationAsset::NoAudioTrigger);
+        EXPECT_EQ(
+            asset.GetAudioTriggerId(2), ConversationAsset::NoAudioTrigger);
+    }
+
+    TEST(
+        ConversationAssetTests,
+        HasResponses_RebuildResponseGraph_ResolvesResponseIndices)
+    {
+        using namespace Conversation;
+
+        ConversationAsset asset{};
+
+        DialogueData parent{ UniqueId::CreateRandomId() };
+        DialogueData const first{ UniqueId::CreateRandomId() };
+        DialogueData const second{ UniqueId::CreateRandomId() };
+        parent.AddResponseId(second.GetId());
+        parent.AddResponseId(UniqueId::CreateRandomId());
+        parent.AddResponseId(first.GetId());
+
+        asset.AddDialogue(parent);
+        asset.AddDialogue(first);
+        asset.AddDialogue(second);
+        EXPECT_FALSE(asset.HasResponseGraph());
+
+        asset.RebuildResponseGraph();
+        ASSERT_TRUE(asset.HasResponseGraph());
+
+        // The dangling response ID is dropped and the order is kept.
+        auto const responseIndices =
+            asset.GetResponseIndices(asset.GetDialogueIndex(parent.GetId()));
+        ASSERT_EQ(responseIndices.size(), 2);
+        EXPECT_EQ(responseIndices[0], asset.GetDialogueIndex(second.GetId()));
+        EXPECT_EQ(responseIndices[1], asset.GetDialogueIndex(first.GetId()));
+        EXPECT_TRUE(
+            asset.GetResponseIndices(asset.GetDialogueIndex(first.GetId()))
+                .empty());
+
+        asset.AddResponse({ first.GetId(), second.GetId() });
+        EXPECT_FALSE(asset.HasResponseGraph());
+    }
+
+    TEST(
+        ConversationAssetTests,
+        HasEditorData_StripEditorData_KeepsRuntimeData)
+    {
+        using namespace Conversation;
+
+        ConversationAsset asset{};
+
+        DialogueData parent{ UniqueId::CreateRandomId() };
+        parent.SetShortText("Hello there.");
+        parent.SetComment("Only the writers need this.");
+        DialogueData const response{ UniqueId::CreateRandomId() };
+
+        asset.AddDialogue(parent);
+        asset.AddDialogue(response);
+        asset.AddResponse({ parent.GetId(), response.GetId() });
+
+        asset.StripEditorData();
+
+        auto const* const stripped = asset.FindDialogue(parent.GetId());
+        ASSERT_NE(stripped, nullptr);
+        EXPECT_TRUE(stripped->GetComment().empty());
+        EXPECT_EQ(stripped->GetShortText(), "Hello there.");
+        ASSERT_EQ(stripped->CountResponseIds(), 1);
+        EXPECT_FALSE(stripped->HasCinematic());
+    }
+
+    TEST(ConversationAssetTests, HasDialogues_WriteThenRead_RoundTrips)
+    {
+        using namespace Conversation;
+
+        ConversationAsset source{};
+
+        DialogueData parent{ UniqueId::CreateRandomId() };
+        parent.SetShortText("Hello there.");
+        parent.SetSpeaker("owner");
+        parent.SetComment("A greeting.");
+        parent.SetEntryDelay(0.5f);
+        parent.SetExitDelay(2.0f);
+        parent.SetScriptIndex(3);
+        DialogueData response{ UniqueId::CreateRandomId() };
+        response.SetShortText("General Kenobi.");
+        response.SetSpeaker("player");
+        DialogueCondition condition;
+        ASSERT_TRUE(condition.SetCode({ { ConditionOp::PushUint, 1 } }));
+        response.SetCondition(condition);
+        // Keeps the name registered until the keys are resolved.
+        AZ::Name const availabilityKey{ "CanRespond" };
+        response.SetAvailabilityId(availabilityKey.GetStringView());
+        response.SetAvailabilityScriptIndex(4);
+
+        source.AddDialogue(parent);
+        source.AddDialogue(response);
+        source.AddResponse({ parent.GetId(), response.GetId() });
+        source.AddStartingId(parent.GetId());
+
+        AZStd::vector<AZ::u8> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> stream{ &buffer };
+        ASSERT_TRUE(
+            AssetFormat::WriteConversationAsset(source, stream).IsSuccess());
+        EXPECT_TRUE(AssetFormat::IsBinaryProduct(buffer));
+
+        ConversationAsset loaded{};
+        ASSERT_TRUE(
+            AssetFormat::ReadConversationAsset(buffer, loaded).IsSuccess());
+
+        ASSERT_EQ(loaded.CountDialogues(), 2);
+        ASSERT_EQ(loaded.CountStartingIds(), 1);
+        EXPECT_EQ(loaded.GetStartingIds().front(), parent.GetId());
+
+        auto const* const loadedParent = loaded.FindDialogue(parent.GetId());
+        ASSERT_NE(loadedParent, nullptr);
+        EXPECT_EQ(loadedParent->GetShortText(), "Hello there.");
+        EXPECT_EQ(loadedParent->GetSpeaker(), "owner");
+        EXPECT_EQ(loadedParent->GetComment(), "A greeting.");
+        EXPECT_FLOAT_EQ(loadedParent->GetEntryDelay(), 0.5f);
+        EXPECT_FLOAT_EQ(loadedParent->GetExitDelay(), 2.0f);
+        EXPECT_EQ(loadedParent->GetScriptIndex(), 3);
+        EXPECT_EQ(
+            loadedParent->GetAvailabilityScriptIndex(),
+            DialogueData::NoScriptIndex);
+        EXPECT_EQ(
+            loaded.FindDialogue(response.GetId())->GetAvailabilityScriptIndex(),
+            4);
+        ASSERT_EQ(loadedParent->CountResponseIds(), 1);
+        EXPECT_EQ(loadedParent->GetResponseIds().front(), response.GetId());
+        EXPECT_TRUE(loadedParent->GetCondition().IsEmpty());
+        EXPECT_EQ(
+            loaded.FindDialogue(response.GetId())
+                ->GetCondition()
+                .GetCode()
+                .size(),
+            1);
+
+        EXPECT_FALSE(loaded.GetDialogueLookup().IsEmpty());
+        EXPECT_TRUE(loaded.CheckDialogueExists(response.GetId()));
+        EXPECT_FALSE(loaded.CheckDialogueExists(UniqueId::CreateRandomId()));
+
+        ASSERT_TRUE(loaded.HasAvailabilityKeys());
+        EXPECT_EQ(
+            loaded.GetAvailabilityKey(
+                loaded.GetDialogueIndex(response.GetId())),
+            "CanRespond");
+
+        ASSERT_TRUE(loaded.HasResponseGraph());
+        auto const responseIndices = loaded.GetResponseIndices(
+            loaded.GetDialogueIndex(parent.GetId()));
+        ASSERT_EQ(responseIndices.size(), 1);
+        EXPECT_EQ(
+            loaded.GetDialogueByIndex(responseIndices.front()).GetId(),
+            response.GetId());
+
+        buffer.resize(buffer.size() / 2);
+        ConversationAsset truncated{};
+        EXPECT_FALSE(
+            AssetFormat::ReadConversationAsset(buffer, truncated).IsSuccess());
+    }
+
+    TEST(ConversationAssetTests, HasChunkText_WriteExternalText_StreamsText)
+    {
+        using namespace Conversation;
+
+        ConversationAsset source{};
+
+        DialogueChunk chunk{};
+        chunk.SetData("Hello there. It has been a long time.");
+        DialogueData dialogue{ UniqueId::CreateRandomId() };
+        dialogue.SetShortText("Hello there.");
+        dialogue.SetChunk(chunk);
+        source.AddDialogue(dialogue);
+
+        AZStd::vector<AZ::u8> buffer;
+        AZStd::vector<AZ::u8> chunkTextBuffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> stream{ &buffer };
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> chunkTextStream{
+            &chunkTextBuffer
+        };
+        ASSERT_TRUE(AssetFormat::WriteConversationAsset(
+                        source, stream, &chunkTextStream)
+                        .IsSuccess());
+
+        AZStd::string_view const chunkText{
+            reinterpret_cast<char const*>(chunkTextBuffer.data()),
+            chunkTextBuffer.size()
+        };
+        EXPECT_NE(chunkText.find(chunk.GetData()), AZStd::string_view::npos);
+
+        ConversationAsset loaded{};
+        ASSERT_TRUE(
+            AssetFormat::ReadConversationAsset(buffer, loaded).IsSuccess());
+        ASSERT_EQ(loaded.CountDialogues(), 1);
+        EXPECT_TRUE(loaded.IsChunkTextStreamed());
+        EXPECT_EQ(loaded.GetDialogueByIndex(0).GetShortText(), "Hello there.");
+        // Nothing is resident until the text store has loaded it.
+        EXPECT_TRUE(loaded.GetDialogueByIndex(0).GetChunkAsText().empty());
+        EXPECT_TRUE(loaded.GetChunkText(0).empty());
+
+        AZStd::vector<AZ::u8> embeddedBuffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> embeddedStream{
+            &embeddedBuffer
+        };
+        ASSERT_TRUE(AssetFormat::WriteConversationAsset(source, embeddedStream)
+                        .IsSuccess());
+
+        ConversationAsset embedded{};
+        ASSERT_TRUE(AssetFormat::ReadConversationAsset(embeddedBuffer, embedded)
+                        .IsSuccess());
+        EXPECT_FALSE(embedded.IsChunkTextStreamed());
+        EXPECT_EQ(embedded.GetChunkText(0), chunk.GetData());
+    }
+
+    TEST(
+        ConversationAssetTests,
+        ShortTextFromChunk_WriteExternalText_IsNotSaved)
+    {
+        using namespace Conversation;
+
+        ConversationAsset source{};
+
+        DialogueChunk chunk{};
+        chunk.SetData("ShortTextFromChunk: I only live in the text product.");
+        DialogueData dialogue{ UniqueId::CreateRandomId() };
+        dialogue.SetChunk(chunk);
+        ASSERT_EQ(dialogue.GetShortText(), chunk.GetData());
+        source.AddDialogue(dialogue);
+
+        AZStd::vector<AZ::u8> buffer;
+        AZStd::vector<AZ::u8> chunkTextBuffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> stream{ &buffer };
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> chunkTextStream{
+            &chunkTextBuffer
+        };
+        ASSERT_TRUE(AssetFormat::WriteConversationAsset(
+                        source, stream, &chunkTextStream)
+                        .IsSuccess());
+
+        // The string table is part of the main product.
+        AZStd::string_view const product{
+            reinterpret_cast<char const*>(buffer.data()), buffer.size()
+        };
+        EXPECT_EQ(product.find(chunk.GetData()), AZStd::string_view::npos);
+
+        ConversationAsset loaded{};
+        ASSERT_TRUE(
+            AssetFormat::ReadConversationAsset(buffer, loaded).IsSuccess());
+        ASSERT_EQ(loaded.CountDialogues(), 1);
+        EXPECT_TRUE(loaded.GetDialogueByIndex(0).GetShortText().empty());
+
+        // It comes back once the chunk is streamed in.
+        DialogueData streamed{ loaded.GetDialogueByIndex(0) };
+        streamed.SetChunk(chunk);
+        EXPECT_EQ(streamed.GetShortText(), chunk.GetData());
+    }
+
+    TEST(MergedConversationIndexTests, TwoAssets_Build_MergesDialogues)
+    {
+        using namespace Conversation;
+
+        auto const createAsset = []()
+        {
+            return AZ::Data::AssetManager::Instance()
+                .CreateAsset<ConversationAsset>(
+                    AZ::Uuid::CreateRandom(),
+                    AZ::Data::AssetLoadBehavior::PreLoad);
+        };
+        auto baseAsset = createAsset();
+        auto extraAsset = createAsset();
+
+        DialogueData parent{ UniqueId::CreateRandomId() };
+        DialogueData baseShared{ UniqueId::CreateRandomId() };
+        DialogueData extraShared{ baseShared.GetId() };
+        DialogueData const extraResponse{ UniqueId::CreateRandomId() };
+        baseShared.SetShortText("Base");
+        extraShared.SetShortText("Extra");
+        parent.AddResponseId(extraResponse.GetId());
+
+        baseAsset->AddDialogue(parent);
+        baseAsset->AddDialogue(baseShared);
+        baseAsset->AddStartingId(parent.GetId());
+        extraAsset->AddDialogue(extraShared);
+        extraAsset->AddDialogue(extraResponse);
+        extraAsset->AddStartingId(parent.GetId());
+
+        MergedConversationIndex index;
+        index.Build({ baseAsset, extraAsset });
+
+        EXPECT_EQ(index.CountDialogues(), 3);
+        EXPECT_EQ(index.CountStartingIds(), 1);
+        // The first asset wins when an ID is used twice.
+        EXPECT_EQ(
+            index.GetDialogueHandle(baseShared.GetId()).GetShortText(),
+            "Base");
+
+        // A response can live in a different asset than its parent.
+        auto const responses = index.GetResponseHandles(parent.GetId());
+        ASSERT_EQ(responses.size(), 1);
+        EXPECT_EQ(responses[0].GetAsset(), extraAsset.Get());
+        EXPECT_EQ(responses[0].GetId(), extraResponse.GetId());
+    }
+
+    TEST(ConversationSessionTests, ActiveSession_Reset_KeepsNoDialogue)
+    {
+        using namespace Conversation;
+
+        ConversationAsset asset{};
+        DialogueData active{ UniqueId::CreateRandomId() };
+        DialogueData response{ UniqueId::CreateRandomId() };
+        response.SetShortText("Farewell.");
+        asset.AddDialogue(active);
+        asset.AddDialogue(response);
+
+        ConversationSession session;
+        session.SetState(DialogueState::Active);
+        session.SetActiveDialogue(active);
+        session.SetResponses({ asset.GetDialogueHandle(response.GetId()) });
+
+        auto const& copies = session.CopyResponses();
+        ASSERT_EQ(copies.size(), 1);
+        EXPECT_EQ(copies.front().GetShortText(), "Farewell.");
+
+        session.Reset();
+        EXPECT_EQ(session.GetState(), DialogueState::Inactive);
+        EXPECT_FALSE(session.HasActiveDialogue());
+        EXPECT_FALSE(session.HasResponses());
+    }
+
+    TEST(ConversationSessionTests, SpeculativeStep_EpochMoves_IsNotUsed)
+    {
+        using namespace Conversation;
+
+        ConversationAsset asset{};
+        DialogueData next{ UniqueId::CreateRandomId() };
+        asset.AddDialogue(next);
+
+        ConversationSession session;
+        auto const serial = session.RestartSpeculation(7);
+        session.AddSpeculativeStep(
+            next.GetId(), { asset.GetDialogueHandle(next.GetId()) });
+
+        auto const* const responses =
+            session.FindSpeculativeResponses(next.GetId(), 7);
+        ASSERT_NE(responses, nullptr);
+        EXPECT_EQ(responses->size(), 1);
+        EXPECT_EQ(session.FindSpeculativeResponses(next.GetId(), 8), nullptr);
+
+        // Stopping makes the speculation in flight stale.
+        session.StopSpeculation();
+        EXPECT_NE(session.GetSpeculationSerial(), serial);
+        EXPECT_EQ(session.FindSpeculativeResponses(next.GetId(), 7), nullptr);
+    }
+
+    TEST(DialoguePayloadTests, SessionPayload_GetResponse_ReadsInPlace)
+    {
+        using namespace Conversation;
+
+        ConversationAsset asset{};
+        DialogueData active{ UniqueId::CreateRandomId() };
+        active.SetShortText("Hello there.");
+        DialogueData response{ UniqueId::CreateRandomId() };
+        response.SetShortText("General Kenobi.");
+        asset.AddDialogue(active);
+        asset.AddDialogue(response);
+
+        ConversationSession session;
+        session.SetActiveDialogue(active);
+        session.SetResponses({ asset.GetDialogueHandle(response.GetId()) });
+
+        DialoguePayload const payload{ &session.GetActiveDialogue(),
+                                       session.GetResponses() };
+        ASSERT_TRUE(payload.IsValid());
+        EXPECT_EQ(payload.GetDialogueId(), active.GetId());
+        EXPECT_EQ(payload.GetShortText(), "Hello there.");
+        ASSERT_EQ(payload.CountResponses(), 1);
+        EXPECT_EQ(payload.GetResponse(0).GetShortText(), "General Kenobi.");
+        EXPECT_FALSE(payload.GetResponse(1).IsValid());
+    }
+
+    TEST(ConversationSessionPoolTests, ReleasedSession_Find_HandleIsStale)
+    {
+        using namespace Conversation;
+
+        ConversationSessionPool pool;
+        AZ::EntityId const owner{ 42 };
+        auto const handle = pool.Acquire(owner);
+        ASSERT_NE(pool.Find(handle), nullptr);
+        EXPECT_EQ(pool.Find(handle)->GetOwner(), owner);
+        EXPECT_EQ(pool.CountSessions(), 1);
+
+        pool.Release(handle);
+        EXPECT_EQ(pool.Find(handle), nullptr);
+        EXPECT_EQ(pool.CountSessions(), 0);
+
+        // The slot is reused, but the old handle must not see the new session.
+        auto const reused = pool.Acquire(owner);
+        EXPECT_EQ(reused.m_index, handle.m_index);
+        EXPECT_EQ(pool.Find(handle), nullptr);
+        EXPECT_NE(pool.Find(reused), nullptr);
+    }
+
+    TEST(ActiveConversationRegistryTests, TwoTargets_RemoveOne_InitiatorStays)
+    {
+        using namespace Conversation;
+
+        AZ::EntityId const player{ 0x1 };
+        AZ::EntityId const firstTarget{ 0x2 };
+        AZ::EntityId const secondTarget{ 0x3 };
+
+        ActiveConversationRegistry registry;
+        registry.Add({ firstTarget, player, true });
+        registry.Add({ secondTarget, player, false });
+        EXPECT_EQ(registry.CountConversations(), 2);
+
+        registry.Remove(firstTarget);
+        EXPECT_FALSE(registry.IsInConversation(firstTarget));
+        EXPECT_TRUE(registry.IsInConversation(player));
+        ASSERT_NE(registry.Find(secondTarget), nullptr);
+        EXPECT_EQ(registry.Find(secondTarget)->m_initiator, player);
+
+        registry.Remove(secondTarget);
+        EXPECT_FALSE(registry.IsInConversation(player));
+        EXPECT_EQ(registry.CountConversations(), 0);
+    }
+
+    TEST(ConversationNotificationQueueTests, QueuedTwice_Flush_SendsLatestOnce)
+    {
+        using namespace Conversation;
+
+        class RecordingHandler : public DialogueNotificationDispatchBus::Handler
+        {
+        public:
+            void DispatchNotification(
+                QueuedNotification const& notification) override
+            {
+                m_received.push_back(notification);
+            }
+
+            AZStd::vector<QueuedNotification> m_received;
+        };
+
+        AZ::EntityId const speaker{ 0x5EA7 };
+        RecordingHandler handler;
+        handler.BusConnect(speaker);
+
+        auto const firstId = UniqueId::CreateNamedId("QueuedDialogue1");
+        auto const secondId = UniqueId::CreateNamedId("QueuedDialogue2");
+
+        ConversationNotificationQueue queue;
+        queue.Push(
+            speaker, { ConversationNotification::Dialogue, {}, firstId });
+        queue.Push(
+            speaker, { ConversationNotification::Dialogue, {}, secondId });
+        queue.Push(speaker, { ConversationNotification::Ended, {}, {} });
+        queue.Push(speaker, { ConversationNotification::Aborted, {}, {} });
+        EXPECT_EQ(queue.CountQueued(), 2);
+
+        queue.Flush();
+        handler.BusDisconnect();
+
+        ASSERT_EQ(handler.m_received.size(), 2);
+        EXPECT_EQ(
+            handler.m_received[0].m_type, ConversationNotification::Dialogue);
+        EXPECT_EQ(handler.m_received[0].m_dialogueId, secondId);
+        EXPECT_EQ(
+            handler.m_received[1].m_type, ConversationNotification::Ended);
+        EXPECT_EQ(queue.CountQueued(), 0);
+    }
+
+    TEST(ConversationNotificationQueueTests, Restarted_Flush_KeepsEveryLine)
+    {
+        using namespace Conversation;
+
+        class RecordingHandler : public DialogueNotificationDispatchBus::Handler
+        {
+        public:
+            void DispatchNotification(
+                QueuedNotification const& notification) override
+            {
+                m_received.push_back(notification);
+            }
+
+            AZStd::vector<QueuedNotification> m_received;
+        };
+
+        AZ::EntityId const speaker{ 0x5EA8 };
+        RecordingHandler handler;
+        handler.BusConnect(speaker);
+
+        auto const firstId = UniqueId::CreateNamedId("RestartedDialogue1");
+        auto const secondId = UniqueId::CreateNamedId("RestartedDialogue2");
+
+        // Two whole conversations within a single tick.
+        ConversationNotificationQueue queue;
+        queue.Push(speaker, { ConversationNotification::Started, {}, {} });
+        queue.Push(
+            speaker, { ConversationNotification::Dialogue, {}, firstId });
+        queue.Push(speaker, { ConversationNotification::Ended, {}, {} });
+        queue.Push(speaker, { ConversationNotification::Started, {}, {} });
+        queue.Push(
+            speaker, { ConversationNotification::Dialogue, {}, secondId });
+        EXPECT_EQ(queue.CountQueued(), 5);
+
+        queue.Flush();
+        handler.BusDisconnect();
+
+        ASSERT_EQ(handler.m_received.size(), 5);
+        EXPECT_EQ(handler.m_received[1].m_dialogueId, firstId);
+        EXPECT_EQ(
+            handler.m_received[2].m_type, ConversationNotification::Ended);
+        EXPECT_EQ(handler.m_received[4].m_dialogueId, secondId);
+    }
+
+    TEST(ConversationPreloaderTests, ReleaseBelowInterest_SetRadii_IsRaised)
+    {
+        using namespace Conversation;
+
+        ConversationPreloader preloader;
+        preloader.SetRadii(10.0f, 5.0f);
+        EXPECT_FLOAT_EQ(preloader.GetInterestRadius(), 10.0f);
+        // Releasing inside the interest radius would reload on the next scan.
+        EXPECT_FLOAT_EQ(preloader.GetReleaseRadius(), 10.0f);
+
+        preloader.SetRadii(10.0f, 12.0f);
+        EXPECT_FLOAT_EQ(preloader.GetReleaseRadius(), 12.0f);
+    }
+
+    TEST(TimerWheelTests, ScheduledTimers_Advance_FireWhenDue)
+    {
+        using namespace Conversation;
+
+        TimerWheel wheel;
+        // Spread over the first three levels, so some have to cascade.
+        AZStd::array<AZ::u64, 3> const delays{ 5, 100, 5000 };
+        for (auto const delay : delays)
+        {
+            wheel.Schedule(delay, delay);
+        }
+
+        auto const cancelled = wheel.Schedule(100, 0);
+        EXPECT_TRUE(wheel.IsScheduled(cancelled));
+        wheel.Cancel(cancelled);
+        EXPECT_FALSE(wheel.IsScheduled(cancelled));
+        EXPECT_EQ(wheel.CountTimers(), delays.size());
+
+        AZStd::vector<AZ::u64> fired;
+        // Advancing in uneven steps must not skip over a slot.
+        while (wheel.GetTime() < 6000)
+        {
+            wheel.Advance(
+                7,
+                [&wheel, &fired](TimerWheel::Handle, AZ::u64 payload)
+                {
+                    EXPECT_EQ(payload, wheel.GetTime());
+                    fired.push_back(payload);
+                });
+        }
+
+        ASSERT_EQ(fired.size(), delays.size());
+        EXPECT_TRUE(AZStd::equal(
+            fired.begin(), fired.end(), delays.begin(), delays.end()));
+        EXPECT_EQ(wheel.CountTimers(), 0);
+    }
+
+    TEST(AvailabilityRequestsTests, SingleIdHandler_AreAvailable_FallsBack)
+    {
+        using namespace Conversation;
+
+        class OddIdsAvailable : public AvailabilityRequestBus::Handler
+        {
+        public:
+            auto IsAvailable(AZStd::string_view const availabilityId)
+                -> bool override
+            {
+                return availabilityId.ends_with("1") ||
+                    availabilityId.ends_with("3");
+            }
+        };
+
+        AZ::EntityId const entityId{ AZ::Entity::MakeId() };
+        OddIdsAvailable handler;
+        handler.BusConnect(entityId);
+
+        AvailabilityMask mask{};
+        AvailabilityRequestBus::EventResult(
+            mask,
+            entityId,
+            &AvailabilityRequests::AreAvailable,
+            AZStd::vector<AZStd::string>{ "1", "2", "3", "4" });
+        EXPECT_EQ(mask, 0b0101U);
+
+        handler.BusDisconnect();
+    }
+
+    TEST(ConversationSystemTests, Running_BumpWorldStateEpoch_EpochAdvances)
+    {
+        using namespace Conversation;
+
+        auto* const conversation = ConversationInterface::Get();
+        ASSERT_NE(conversation, nullptr);
+
+        auto const epoch = conversation->GetWorldStateEpoch();
+        ConversationRequestBus::Broadcast(
+            &ConversationRequests::BumpWorldStateEpoch);
+        EXPECT_EQ(conversation->GetWorldStateEpoch(), epoch + 1);
+    }
+
     TEST_F(DialogueComponentTests, Fixture_SanityCheck)
     {
         ASSERT_NE(m_dialogueEntity, nullptr);
@@ -444,6 +1328,81 @@ namespace ConversationTest
         EXPECT_EQ(dialogueCurrentState, Conversation::DialogueState::Active);
     }
 
+    TEST_F(
+        DialogueComponentTests,
+        UntaggedPlayerSet_TryStartConversation_IsPlayerConversation)
+    {
+        using namespace Conversation;
+
+        auto* const conversation = ConversationInterface::Get();
+        ASSERT_NE(conversation, nullptr);
+
+        auto asset = CreateStartableAsset();
+        ConversationAssetRefComponentRequestBus::Event(
+            m_dialogueEntity->GetId(),
+            &ConversationAssetRefComponentRequests::SetConversationAsset,
+            asset);
+        m_dialogueEntity->Activate();
+
+        // The player has no tag, so only the player entity identifies it.
+        AZ::EntityId const player{ AZ::Entity::MakeId() };
+        conversation->SetPlayerEntity(player);
+        DialogueComponentRequestBus::Event(
+            m_dialogueEntity->GetId(),
+            &DialogueComponentRequests::TryToStartConversation,
+            player);
+        conversation->SetPlayerEntity(AZ::EntityId{});
+
+        EXPECT_TRUE(
+            conversation->IsInPlayerConversation(m_dialogueEntity->GetId()));
+
+        DialogueComponentRequestBus::Event(
+            m_dialogueEntity->GetId(),
+            &DialogueComponentRequests::AbortConversation);
+    }
+
+    TEST_F(
+        DialogueComponentTests,
+        AssetNotLoadedAtActivation_AssetReady_ConversationCanStart)
+    {
+        using namespace Conversation;
+
+        // The ref only knows the asset's ID, as it would with NoLoad.
+        AZ::Data::AssetId const assetId{ AZ::Uuid::CreateRandom() };
+        ConversationAssetRefComponentRequestBus::Event(
+            m_dialogueEntity->GetId(),
+            &ConversationAssetRefComponentRequests::SetConversationAsset,
+            AZ::Data::Asset<ConversationAsset>{
+                assetId, azrtti_typeid<ConversationAsset>() });
+        m_dialogueEntity->Activate();
+
+        auto const tryToStartConversation = [this]() -> bool
+        {
+            bool result{};
+            DialogueComponentRequestBus::EventResult(
+                result,
+                m_dialogueEntity->GetId(),
+                &DialogueComponentRequests::TryToStartConversation,
+                AZ::EntityId{ AZ::Entity::MakeId() });
+            return result;
+        };
+
+        EXPECT_FALSE(tryToStartConversation());
+
+        auto asset = AZ::Data::AssetManager::Instance()
+                         .FindOrCreateAsset<ConversationAsset>(
+                             assetId, AZ::Data::AssetLoadBehavior::NoLoad);
+        DialogueData const startingDialogue{ UniqueId::CreateRandomId() };
+        asset->AddDialogue(startingDialogue);
+        asset->AddStartingId(startingDialogue.GetId());
+        AZ::Data::AssetBus::Event(
+            assetId,
+            &AZ::Data::AssetBus::Events::OnAssetReady,
+            AZ::Data::Asset<AZ::Data::AssetData>{ asset });
+
+        EXPECT_TRUE(tryToStartConversation());
+    }
+
     TEST_F(
         DialogueComponentTests,
         ActiveConversation_WithResponsesAvailable_SelectingOutOfBoundsResponseIsRejected)
@@ -523,6 +1482,294 @@ namespace ConversationTest
         }
     }
 
+    TEST_F(
+        DialogueComponentTests,
+        StartableAsset_FindAvailableStartingDialogues_FindsStartingId)
+    {
+        using namespace Conversation;
+
+        auto asset = CreateStartableAsset();
+        ConversationAssetRefComponentRequestBus::Event(
+            m_dialogueEntity->GetId(),
+            &ConversationAssetRefComponentRequests::SetConversationAsset,
+            asset);
+        m_dialogueEntity->Activate();
+
+        auto* const conversation = ConversationInterface::Get();
+        ASSERT_NE(conversation, nullptr);
+
+        // Entities without a dialogue component have nothing to say.
+        AZStd::array<AZ::EntityId, 2> const entityIds{
+            AZ::EntityId{ AZ::Entity::MakeId() }, m_dialogueEntity->GetId()
+        };
+        auto const speakers =
+            conversation->FindAvailableStartingDialogues(entityIds);
+        ASSERT_EQ(speakers.size(), 1);
+        EXPECT_EQ(speakers.front().m_entityId, m_dialogueEntity->GetId());
+        EXPECT_EQ(
+            speakers.front().m_dialogueId,
+            UniqueId::CreateNamedId("StartableAssetDialogueId1"));
+
+        // Nothing is started by asking.
+        DialogueState state{};
+        DialogueComponentRequestBus::EventResult(
+            state,
+            m_dialogueEntity->GetId(),
+            &DialogueComponentRequests::GetCurrentState);
+        EXPECT_EQ(state, DialogueState::Inactive);
+    }
+
+    TEST_F(
+        DialogueComponentTests,
+        ManyNativeSpeakers_FindAvailableStartingDialogues_MatchesSerial)
+    {
+        using namespace Conversation;
+
+        auto* const conversation = ConversationInterface::Get();
+        ASSERT_NE(conversation, nullptr);
+
+        constexpr auto FactName = "ManyNativeSpeakersTest_Unlocked";
+        DialogueCondition lockedCondition;
+        ASSERT_TRUE(lockedCondition.SetCode(
+            { { ConditionOp::PushFact,
+                static_cast<AZ::u32>(AZ::Crc32(FactName)) },
+              { ConditionOp::PushUint, 1 },
+              { ConditionOp::Equal, 0 } }));
+        DialogueCondition openCondition;
+        ASSERT_TRUE(openCondition.SetCode({ { ConditionOp::PushUint, 1 } }));
+
+        auto const createAsset =
+            [](AZStd::initializer_list<DialogueData> startingDialogues)
+        {
+            auto asset = AZ::Data::AssetManager::Instance()
+                             .CreateAsset<ConversationAsset>(
+                                 AZ::Uuid::CreateRandom(),
+                                 AZ::Data::AssetLoadBehavior::PreLoad);
+            for (DialogueData const& dialogue : startingDialogues)
+            {
+                asset->AddDialogue(dialogue);
+                asset->AddStartingId(dialogue.GetId());
+            }
+            return asset;
+        };
+
+        // One asset falls back to an open line, the other has nothing to say
+        // until the fact is set, so the speakers' answers differ.
+        DialogueData locked{ UniqueId::CreateRandomId() };
+        locked.SetCondition(lockedCondition);
+        DialogueData open{ UniqueId::CreateRandomId() };
+        open.SetCondition(openCondition);
+        DialogueData otherLocked{ UniqueId::CreateRandomId() };
+        otherLocked.SetCondition(lockedCondition);
+        auto const fallbackAsset = createAsset({ locked, open });
+        auto const lockedAsset = createAsset({ otherLocked });
+
+        // Enough speakers that the checks are split across jobs.
+        constexpr size_t SpeakerCount{ 80 };
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> speakers;
+        AZStd::vector<AZ::EntityId> speakerIds;
+        for (size_t index{}; index < SpeakerCount; ++index)
+        {
+            auto& speaker =
+                speakers.emplace_back(AZStd::make_unique<AZ::Entity>());
+            speaker->CreateComponent(TagComponentType);
+            speaker->CreateComponent(ConversationAssetRefComponentType);
+            speaker->CreateComponent(DialogueComponentType);
+            speaker->Init();
+            ConversationAssetRefComponentRequestBus::Event(
+                speaker->GetId(),
+                &ConversationAssetRefComponentRequests::SetConversationAsset,
+                index % 2 == 0 ? fallbackAsset : lockedAsset);
+            speaker->Activate();
+            speakerIds.push_back(speaker->GetId());
+        }
+
+        auto const expectMatchesSerial = [conversation, &speakerIds]()
+        {
+            auto const together =
+                conversation->FindAvailableStartingDialogues(speakerIds);
+
+            AZStd::vector<AvailableStartingDialogue> oneByOne;
+            for (AZ::EntityId const& speakerId : speakerIds)
+            {
+                auto const found = conversation->FindAvailableStartingDialogues(
+                    AZStd::span<AZ::EntityId const>{ &speakerId, 1 });
+                oneByOne.insert(oneByOne.end(), found.begin(), found.end());
+            }
+
+            EXPECT_EQ(together.size(), oneByOne.size());
+            auto const count = AZStd::min(together.size(), oneByOne.size());
+            for (size_t index{}; index < count; ++index)
+            {
+                EXPECT_EQ(
+                    together[index].m_entityId, oneByOne[index].m_entityId);
+                EXPECT_EQ(
+                    together[index].m_dialogueId, oneByOne[index].m_dialogueId);
+            }
+            return together;
+        };
+
+        auto const beforeFact = expectMatchesSerial();
+        ASSERT_EQ(beforeFact.size(), SpeakerCount / 2);
+        EXPECT_EQ(beforeFact.front().m_dialogueId, open.GetId());
+
+        conversation->SetFact(FactName, 1);
+        auto const afterFact = expectMatchesSerial();
+        conversation->SetFact(FactName, 0);
+        ASSERT_EQ(afterFact.size(), SpeakerCount);
+        EXPECT_EQ(afterFact[0].m_dialogueId, locked.GetId());
+        EXPECT_EQ(afterFact[1].m_dialogueId, otherLocked.GetId());
+
+        for (auto& speaker : speakers)
+        {
+            speaker->Deactivate();
+        }
+    }
+
+    TEST_F(
+        DialogueComponentTests,
+        NoLegacyListener_SpeakDialogue_SkipsOnDialogue)
+    {
+        using namespace Conversation;
+
+        class SpokenHandler : public DialogueComponentNotificationBus::Handler
+        {
+        public:
+            [[nodiscard]] auto GetDialogueComponentNotificationOrder()
+                -> int override
+            {
+                return DialogueComponentNotificationPriority::Default;
+            }
+
+            void OnDialogueSpoken(
+                [[maybe_unused]] DialoguePayload const& payload) override
+            {
+                ++m_spokenCount;
+            }
+
+            void OnDialogue(
+                [[maybe_unused]] DialogueData const& dialogue,
+                [[maybe_unused]] AZStd::vector<DialogueData> const&
+                    potentialResponses) override
+            {
+                ++m_legacyCount;
+            }
+
+            [[nodiscard]] auto WantsOnDialogue() -> bool override
+            {
+                return false;
+            }
+
+            int m_spokenCount{};
+            int m_legacyCount{};
+        };
+
+        auto asset = CreateStartableAsset();
+        ConversationAssetRefComponentRequestBus::Event(
+            m_dialogueEntity->GetId(),
+            &ConversationAssetRefComponentRequests::SetConversationAsset,
+            asset);
+        m_dialogueEntity->Activate();
+
+        SpokenHandler handler;
+        handler.BusConnect(m_dialogueEntity->GetId());
+        DialogueComponentRequestBus::Event(
+            m_dialogueEntity->GetId(),
+            &DialogueComponentRequests::TryToStartConversation,
+            AZ::Entity::MakeId());
+        handler.BusDisconnect();
+
+        EXPECT_EQ(handler.m_spokenCount, 1);
+        EXPECT_EQ(handler.m_legacyCount, 0);
+    }
+
+    TEST_F(
+        DialogueComponentTests,
+        QueuedNotifications_RestartWithinTick_SendsEveryConversationsLine)
+    {
+        using namespace Conversation;
+
+        class RecordingHandler
+            : public DialogueComponentNotificationBus::Handler
+        {
+        public:
+            [[nodiscard]] auto GetDialogueComponentNotificationOrder()
+                -> int override
+            {
+                return DialogueComponentNotificationPriority::Default;
+            }
+
+            void OnDialogueSpoken(DialoguePayload const& payload) override
+            {
+                m_received.emplace_back(payload.GetShortText());
+            }
+
+            void OnConversationStarted(
+                [[maybe_unused]] AZ::EntityId initiatingEntity) override
+            {
+                m_received.emplace_back("Started");
+            }
+
+            void OnConversationEnded() override
+            {
+                m_received.emplace_back("Ended");
+            }
+
+            AZStd::vector<AZStd::string> m_received;
+        };
+
+        auto* const queue = ConversationNotificationQueueInterface::Get();
+        ASSERT_NE(queue, nullptr);
+
+        DialogueComponentConfig config{};
+        config.m_queueNotifications = true;
+        m_dialogueEntity->FindComponent(DialogueComponentType)
+            ->SetConfiguration(config);
+
+        auto asset = CreateStartableAsset();
+        ConversationAssetRefComponentRequestBus::Event(
+            m_dialogueEntity->GetId(),
+            &ConversationAssetRefComponentRequests::SetConversationAsset,
+            asset);
+        m_dialogueEntity->Activate();
+
+        RecordingHandler handler;
+        handler.BusConnect(m_dialogueEntity->GetId());
+
+        // Start, answer, end and start again, all within one tick.
+        auto const speakerId = m_dialogueEntity->GetId();
+        DialogueComponentRequestBus::Event(
+            speakerId,
+            &DialogueComponentRequests::TryToStartConversation,
+            AZ::Entity::MakeId());
+        DialogueComponentRequestBus::Event(
+            speakerId, &DialogueComponentRequests::ContinueConversation);
+        DialogueComponentRequestBus::Event(
+            speakerId, &DialogueComponentRequests::ContinueConversation);
+        DialogueComponentRequestBus::Event(
+            speakerId,
+            &DialogueComponentRequests::TryToStartConversation,
+            AZ::Entity::MakeId());
+        EXPECT_TRUE(handler.m_received.empty());
+
+        queue->Flush();
+        handler.BusDisconnect();
+        DialogueComponentRequestBus::Event(
+            speakerId, &DialogueComponentRequests::AbortConversation);
+        queue->FlushEntity(speakerId);
+
+        // The first conversation's last line is sent, even though another
+        // conversation was active by the flush.
+        AZStd::vector<AZStd::string> const expected{
+            "Started",
+            "I am from Earth, duh.",
+            "Ended",
+            "Started",
+            "Hello, where are you from?"
+        };
+        EXPECT_EQ(handler.m_received, expected);
+    }
+
     TEST_F(
         DialogueComponentTests,
         TryStartConversation_CallWithInvalidData_FailsWithInactiveDialogueState)
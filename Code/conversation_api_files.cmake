@@ -1,17 +1,26 @@
 
 set(FILES
     Include/Conversation/AvailabilityBus.h
+    Include/Conversation/ChunkTextStore.h
     Include/Conversation/CinematicBus.h
     Include/Conversation/Constants.h
     Include/Conversation/ConversationBus.h
     Include/Conversation/DialogueChunk.h
+    Include/Conversation/DialogueChunkStore.h
+    Include/Conversation/DialogueCondition.h
     Include/Conversation/DialogueData.h
+    Include/Conversation/DialogueHandle.h
+    Include/Conversation/DialogueLookupTable.h
+    Include/Conversation/DialoguePayload.h
     Include/Conversation/ConversationAsset.h
+    Include/Conversation/ConversationAssetFormat.h
     Include/Conversation/ConversationTypeIds.h
     Include/Conversation/DialogueComponentBus.h
     Include/Conversation/DialogueScript.h
     Include/Conversation/IConversationAsset.h
+    Include/Conversation/InternTable.h
     Include/Conversation/ResponseData.h
+    Include/Conversation/StringPool.h
     Include/Conversation/UniqueId.h
     Include/Conversation/Util.h
 
@@ -5,13 +5,37 @@ set(FILES
     Source/ConversationSystemComponent.cpp
     Source/ConversationSystemComponent.h
 
+    Source/ActiveConversationRegistry.cpp
+    Source/ActiveConversationRegistry.h
+    Source/ChunkTextStore.cpp
     Source/ConversationAsset.cpp
+    Source/ConversationAssetFormat.cpp
+    Source/ConversationNotificationQueue.cpp
+    Source/ConversationNotificationQueue.h
+    Source/ConversationPreloader.cpp
+    Source/ConversationPreloader.h
+    Source/ConversationSession.cpp
+    Source/ConversationSession.h
+    Source/ConversationSessionPool.cpp
+    Source/ConversationSessionPool.h
+    Source/DialogueChunkStore.cpp
     Source/DialogueComponent.cpp
+    Source/DialogueCondition.cpp
     Source/DialogueComponent.h
     Source/DialogueData.cpp
+    Source/DialogueHandle.cpp
+    Source/DialogueScheduler.h
+    Source/DialogueLookupTable.cpp
+    Source/DialoguePayload.cpp
     Source/Logging.h
+    Source/MergedConversationIndex.cpp
+    Source/MergedConversationIndex.h
+    Source/StringPool.cpp
+    Source/TimerWheel.cpp
+    Source/TimerWheel.h
     Source/DialogueAudioControl.cpp
     Source/DialogueAudioControl.h
+    Source/InternedTextSerializer.h
 
     Source/Components/DialogueComponentConfig.cpp
     Source/Components/ConversationAssetRefComponent.cpp
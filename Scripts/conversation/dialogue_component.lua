@@ -4,8 +4,13 @@ local conditionLib = require("conversation.condition")
 
 local lib = {}
 
+-- Matches DialogueData::NoScriptIndex.
+lib.NoScriptIndex = 0xFFFFFFFF
+
 lib.ScriptDialogueComponent = {
 	conditions = {},
+	-- The generated script's functions, in the order the asset's script indices refer to them.
+	scriptFunctions = {},
 	dialogueComponentNotificationHandler = nil,
 	availabilityRequestBusHandler = nil,
 }
@@ -57,8 +62,6 @@ function lib.ScriptDialogueComponent:GetOwnerEntityId()
 	return self.entityId
 end
 
-function lib.ScriptDialogueComponent:OnDialogue(dialogue, availableResponses) end
-
 -- @brief Executes the script attached to a dialogue.
 --
 -- Nothing happens if no script is found that matches the Id..
@@ -72,6 +75,18 @@ function lib.ScriptDialogueComponent:RunDialogueScript(nodeId)
 	end
 end
 
+-- @brief Executes a function from the generated function table.
+--
+-- Nothing happens if the index is outside of the table.
+--
+-- @param scriptIndex The zero-based index the conversation asset stores for the dialogue
+function lib.ScriptDialogueComponent:RunDialogueScriptByIndex(scriptIndex)
+	local nodeFunc = self.scriptFunctions[scriptIndex + 1]
+	if type(nodeFunc) == "function" then
+		return nodeFunc(self)
+	end
+end
+
 -------------------------------------------------------------------------------
 -- @brief Runs and returns the return of the given node's condition script(s).
 --
@@ -101,6 +116,59 @@ function lib.ScriptDialogueComponent:IsAvailable(nodeId)
 	return true
 end
 
+-------------------------------------------------------------------------------
+-- @brief Runs the condition script(s) of several nodes in one call.
+--
+-- @param nodeIds The Ids of the nodes to check.
+-- @returns A bitmask where bit (i - 1) is set if nodeIds[i] is available.
+-------------------------------------------------------------------------------
+function lib.ScriptDialogueComponent:AreAvailable(nodeIds)
+	local mask = 0
+
+	for index = 1, #nodeIds do
+		if self:IsAvailable(nodeIds[index]) then
+			mask = mask | (1 << (index - 1))
+		end
+	end
+
+	return mask
+end
+
+-------------------------------------------------------------------------------
+-- @brief Runs the condition functions of several nodes by their table index.
+--
+-- Nodes without an index are checked by name instead.
+--
+-- @param scriptIndices The zero-based function table index of each node.
+-- @param nodeIds The Ids of the nodes to check.
+-- @returns A bitmask where bit (i - 1) is set if nodeIds[i] is available.
+-------------------------------------------------------------------------------
+function lib.ScriptDialogueComponent:AreAvailableByIndex(scriptIndices, nodeIds)
+	local mask = 0
+
+	for index = 1, #nodeIds do
+		local scriptIndex = scriptIndices[index]
+		local isAvailable
+		if scriptIndex ~= lib.NoScriptIndex then
+			local conditionFunc = self.scriptFunctions[scriptIndex + 1]
+			-- Conditions that are functions must return a boolean type.
+			if type(conditionFunc) == "function" then
+				isAvailable = conditionFunc(self) == true
+			end
+		end
+
+		if isAvailable == nil then
+			isAvailable = self:IsAvailable(nodeIds[index])
+		end
+
+		if isAvailable then
+			mask = mask | (1 << (index - 1))
+		end
+	end
+
+	return mask
+end
+
 -------------------------------------------------------------------------------
 -- @brief Helper for adding a condition script to a dialogue.
 --
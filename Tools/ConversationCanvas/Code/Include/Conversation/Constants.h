@@ -1,7 +0,0 @@
-#pragma once
-
-namespace Conversation
-{
-    constexpr auto const* DialogueSystemCategory = "BoP/Conversation";
-    constexpr auto const* DialogueSystemModule = "dialogue";
-} // namespace Conversation
@@ -1,29 +0,0 @@
-#pragma once
-
-namespace Conversation
-{
-    // clang-format off
-    constexpr auto ConversationAssetRefComponentTypeId { "{2A4DACCE-2AEA-4007-93C5-8F5EF1110DA8}" };
-    constexpr auto ConversationAssetInterfaceTypeId    { "{E055BA9A-31A0-48B5-B5B8-CD758771B151}" };
-    constexpr auto ConversationAssetTypeId             { "{C2B4E407-B74E-4E48-8B8A-ADD5BCC894D1}" };
-    constexpr auto ConversationSystemComponentTypeId   { "{30f94275-e830-466f-b1c6-140156911232}" };
-    constexpr auto ConversationVMTypeId                { "{8D316C6D-7EDC-4C11-A885-0C10CF41BA52}" };
-    constexpr auto DialogueComponentConfigTypeId       { "{88CFED66-271F-4CC7-A573-E7E0C9456ECD}" };
-    constexpr auto DialogueComponentTypeId             { "{C7AFDF51-ECCC-4BD3-8A56-0763ED87CB5B}" };
-    constexpr auto DialogueDataTypeId                  { "{6BF81F0F-0013-4877-80EB-4DC579005DDE}" };
-    constexpr auto DialogueIdTypeId                    { "{68AE77C6-9865-47DE-8BFE-D6D67663C5DC}" };
-    constexpr auto ResponseDataTypeId                  { "{AEC51FC7-A91F-40D6-8EBA-59D0EADBAA4C}" };
-    constexpr auto TagComponentTypeId                  { "{0F16A377-EAA0-47D2-8472-9EAAA680B169}" };
-    constexpr auto VMValueTypeId                       { "{ED542FA7-A789-4E54-95D7-E2330FFD6768}" };
-
-    // clang-format on
-} // namespace Conversation
-
-namespace ConversationEditor
-{
-
-    // clang-format off
-    constexpr auto ConversationEditorSystemComponentTypeId  = "{BCD6E4B7-5632-46B4-BA76-B3C4E0B98310}";
-    constexpr auto EditorDialogueComponentTypeId            = "{D7F22D09-81D4-47FF-A02F-B38E61C0575F}";
-    // clang-format on
-} // namespace ConversationEditor
@@ -1,13 +0,0 @@
-#pragma once
-
-#include <Conversation/DialogueComponentBus.h>
-#include <ScriptCanvas/Core/NodeFunctionGeneric.h>
-
-namespace BytesOfPi
-{
-    namespace DialogueNodes
-    {
-        static constexpr char const* k_categoryName = "Conversation";
-
-    } // namespace DialogueNodes
-} // namespace BytesOfPi
@@ -1,7 +0,0 @@
-#pragma once
-
-#include "AzCore/RTTI/RTTIMacros.h"
-#include "Conversation/ConversationTypeIds.h"
-namespace Conversation
-{
-} // namespace Conversation
@@ -29,6 +29,12 @@ namespace ConversationCanvas
         constexpr auto NodeTypeKey = "nodeType";
         constexpr auto NodeTypeValue_Dialogue = "Dialogue";
 
+        // Nodes with a condition op can be compiled to a native
+        // DialogueCondition, instead of a companion-script function.
+        constexpr auto ConditionOpKey = "conditionOp";
+        //! Pushes the value of the node's only property slot.
+        constexpr auto ConditionOpValue_Constant = "Constant";
+
     } // namespace NodeSettings
 
     namespace Settings
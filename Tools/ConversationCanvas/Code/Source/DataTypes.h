@@ -50,6 +50,7 @@ namespace ConversationCanvas
         in_isStarter,
         in_name,
         in_parent,
+        in_script,
         in_speakerTag,
         in_shortText,
         out_id);
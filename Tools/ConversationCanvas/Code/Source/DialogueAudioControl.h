@@ -14,6 +14,12 @@ namespace Conversation
 
         static void Reflect(AZ::ReflectContext* context);
 
+        DialogueAudioControl() = default;
+        explicit DialogueAudioControl(AZStd::string_view control)
+            : m_control(control)
+        {
+        }
+
         constexpr auto GetName() const -> AZStd::string_view
         {
             return m_control;
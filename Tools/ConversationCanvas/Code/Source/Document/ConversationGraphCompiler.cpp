@@ -20,6 +20,7 @@
 #include "AzCore/Serialization/SerializeContext.h"
 #include "AzCore/StringFunc/StringFunc.h"
 #include "AzCore/Utils/Utils.h"
+#include "AzCore/std/containers/array.h"
 #include "AzCore/std/smart_ptr/shared_ptr.h"
 #include "AzCore/std/string/regex.h"
 #include "AzFramework/Asset/AssetSystemBus.h"
@@ -31,6 +32,7 @@
 #include "Common.h"
 #include "Conversation/ConversationAsset.h"
 #include "Conversation/DialogueChunk.h"
+#include "Conversation/DialogueCondition.h"
 #include "Conversation/DialogueData.h"
 #include "ConversationCanvasTypeIds.h"
 #include "DataTypes.h"
@@ -38,6 +40,60 @@
 
 namespace ConversationCanvas
 {
+    namespace
+    {
+        //! The condition ops of nodes that combine their input slots.
+        constexpr AZStd::array<
+            AZStd::pair<AZStd::string_view, Conversation::ConditionOp>,
+            4>
+            ConditionOperators{ {
+                { "Equal", Conversation::ConditionOp::Equal },
+                { "And", Conversation::ConditionOp::And },
+                { "Or", Conversation::ConditionOp::Or },
+                { "Not", Conversation::ConditionOp::Not },
+            } };
+
+        /**
+         * Appends an instruction that pushes a slot's value. Strings are
+         * pushed as their CRC32, the same way facts are named.
+         */
+        auto AppendConditionValue(
+            AZStd::any const& value,
+            AZStd::vector<Conversation::ConditionInstruction>& code) -> bool
+        {
+            using namespace Conversation;
+
+            if (value.is<bool>())
+            {
+                code.push_back({ ConditionOp::PushUint,
+                                 AZStd::any_cast<bool>(value) ? 1u : 0u });
+            }
+            else if (value.is<int32_t>())
+            {
+                code.push_back({ ConditionOp::PushInt,
+                                 static_cast<AZ::u32>(
+                                     AZStd::any_cast<int32_t>(value)) });
+            }
+            else if (value.is<uint32_t>())
+            {
+                code.push_back({ ConditionOp::PushUint,
+                                 AZStd::any_cast<uint32_t>(value) });
+            }
+            else if (value.is<AZStd::string>())
+            {
+                code.push_back({ ConditionOp::PushUint,
+                                 static_cast<AZ::u32>(AZ::Crc32(
+                                     AZStd::any_cast<AZStd::string>(value))) });
+            }
+            else
+            {
+                return false;
+            }
+
+            return true;
+        }
+    } // namespace
+
     AZ_CLASS_ALLOCATOR_IMPL(ConversationGraphCompiler, AZ::SystemAllocator);
     AZ_RTTI_NO_TYPE_INFO_IMPL(
         ConversationGraphCompiler, AtomToolsFramework::GraphCompiler);
@@ -195,6 +251,14 @@ namespace ConversationCanvas
             }
 
             DeleteExistingFilesForCurrentNode();
+
+            // Dialogues check native conditions themselves, so they don't
+            // need a function in the companion script.
+            if (IsNativeCondition(currentNode))
+            {
+                continue;
+            }
+
             PreprocessTemplatesForCurrentNode();
             BuildInstructionsForCurrentNode(currentNode);
         };
@@ -834,6 +898,8 @@ namespace ConversationCanvas
                     AZ::StringFunc::Join(
                         luaFunc, templateFileData.GetLines(), "\n");
                     m_functionDefinitions.emplace_back(luaFunc);
+                    m_functionSymbols.emplace_back(
+                        GetSymbolNameFromNode(currentNode));
                 }
             });
     }
@@ -845,6 +911,23 @@ namespace ConversationCanvas
 
         conversationAsset->AddNames(m_names);
 
+        // Dialogues refer to their functions by where they are in the
+        // companion script's function table.
+        AZStd::unordered_map<AZStd::string, AZ::u32> functionIndices;
+        for (AZ::u32 index{}; index < m_functionSymbols.size(); ++index)
+        {
+            functionIndices.emplace(m_functionSymbols[index], index);
+        }
+
+        auto const findFunctionIndex =
+            [&functionIndices](AZStd::string const& symbol) -> AZ::u32
+        {
+            auto const iter = functionIndices.find(symbol);
+            return iter != functionIndices.end()
+                ? iter->second
+                : Conversation::DialogueData::NoScriptIndex;
+        };
+
         AZStd::ranges::for_each(
             m_startingIds,
             [&conversationAsset](auto const& startingId) -> void
@@ -854,13 +937,17 @@ namespace ConversationCanvas
 
         AZStd::ranges::for_each(
             m_nodeDataTable,
-            [&conversationAsset](auto& pair) -> void
+            [&conversationAsset, &findFunctionIndex](auto& pair) -> void
             {
                 auto& nodeData = pair.second;
                 if (auto& dialogueDataOpt = nodeData.m_dialogue;
                     dialogueDataOpt.has_value())
                 {
                     dialogueDataOpt->AddResponses(nodeData.m_responseIds);
+                    dialogueDataOpt->SetScriptIndex(
+                        findFunctionIndex(nodeData.m_scriptSymbol));
+                    dialogueDataOpt->SetAvailabilityScriptIndex(
+                        findFunctionIndex(nodeData.m_availabilitySymbol));
                     conversationAsset->AddDialogue(*dialogueDataOpt);
                 }
             });
@@ -907,6 +994,29 @@ namespace ConversationCanvas
                 return m_functionDefinitions;
             });
 
+        // The table is what script indices in the conversation asset refer
+        // to, so it must list the functions in the order they were indexed.
+        m_scriptFileDataTemplate.ReplaceLinesInBlock(
+            "BOP_GENERATED_FUNCTION_TABLE_BEGIN",
+            "BOP_GENERATED_FUNCTION_TABLE_END",
+            [&]([[maybe_unused]] AZStd::string const& blockHeader)
+            {
+                auto const graphName = GetUniqueGraphName();
+
+                AZStd::vector<AZStd::string> lines;
+                lines.reserve(m_functionSymbols.size() + 2);
+                lines.push_back(AZStd::string::format(
+                    "%s.scriptFunctions = {", graphName.c_str()));
+                for (auto const& symbol : m_functionSymbols)
+                {
+                    lines.push_back(AZStd::string::format(
+                        "\t%s.%s,", graphName.c_str(), symbol.c_str()));
+                }
+                lines.push_back("}");
+
+                return lines;
+            });
+
         auto const templateOutputPath =
             GetOutputPathFromTemplatePath(m_scriptFileDataTemplate.GetPath());
         if (!m_scriptFileDataTemplate.Save(templateOutputPath))
@@ -980,6 +1090,99 @@ namespace ConversationCanvas
         return nodes;
     }
 
+    auto ConversationGraphCompiler::AppendConditionCode(
+        GraphModel::ConstNodePtr const& node,
+        AZStd::vector<Conversation::ConditionInstruction>& code,
+        size_t depth) const -> bool
+    {
+        using namespace Conversation;
+
+        auto const* const dynamicNode =
+            azrtti_cast<AtomToolsFramework::DynamicNode const*>(node.get());
+        // Anything nested deeper couldn't be evaluated anyway.
+        if (!dynamicNode || depth >= DialogueCondition::MaxStackDepth)
+        {
+            return false;
+        }
+
+        auto const& config = dynamicNode->GetConfig();
+        auto const opSetting =
+            config.m_settings.find(NodeSettings::ConditionOpKey);
+        if (opSetting == config.m_settings.end() || opSetting->second.empty())
+        {
+            return false;
+        }
+
+        // An operand is whatever is connected to the slot, or else the
+        // slot's own value.
+        auto const appendOperand =
+            [this, &node, &code, depth](
+                AtomToolsFramework::DynamicNodeSlotConfig const& slotConfig)
+            -> bool
+        {
+            auto const slot = node->GetSlot(slotConfig.m_name);
+            if (!slot)
+            {
+                return false;
+            }
+
+            if (auto const& connections = slot->GetConnections();
+                !connections.empty())
+            {
+                return connections.size() == 1 &&
+                    AppendConditionCode(
+                           connections.front()->GetSourceNode(),
+                           code,
+                           depth + 1);
+            }
+
+            return AppendConditionValue(GetValueFromSlot(slot), code);
+        };
+
+        AZStd::string_view const opName = opSetting->second.front();
+        if (opName == NodeSettings::ConditionOpValue_Constant)
+        {
+            return config.m_propertySlots.size() == 1 &&
+                appendOperand(config.m_propertySlots.front());
+        }
+
+        auto const op = AZStd::ranges::find_if(
+            ConditionOperators,
+            [opName](auto const& pair) -> bool
+            {
+                return pair.first == opName;
+            });
+        if (op == ConditionOperators.end())
+        {
+            return false;
+        }
+
+        size_t const operandCount = op->second == ConditionOp::Not ? 1 : 2;
+        if (config.m_inputSlots.size() != operandCount)
+        {
+            return false;
+        }
+
+        for (auto const& slotConfig : config.m_inputSlots)
+        {
+            if (!appendOperand(slotConfig))
+            {
+                return false;
+            }
+        }
+        code.push_back({ op->second, 0 });
+
+        return true;
+    }
+
+    auto ConversationGraphCompiler::IsNativeCondition(
+        GraphModel::ConstNodePtr const& node) const -> bool
+    {
+        AZStd::vector<Conversation::ConditionInstruction> code;
+        return AppendConditionCode(node, code) &&
+            Conversation::DialogueCondition::Validate(code);
+    }
+
     void ConversationGraphCompiler::BuildNode(
         GraphModel::ConstNodePtr const& currentNode)
     {
@@ -1057,8 +1260,10 @@ namespace ConversationCanvas
             targetNodeDataDialogue.emplace(targetDialogueId);
         }
 
-        // Dialogue nodes that have a connection to inCondition will need to add
-        // the connected node's symbol as an availability Id.
+        // Dialogue nodes that have a connection to inCondition use the
+        // connected condition natively if it can be compiled. Otherwise they
+        // add the connected node's symbol as an availability Id, so the
+        // companion script is asked.
         if (auto const inConditionSlot = targetDialogueNode->GetSlot(
                 ToString(DialogueNodeSlots::in_condition));
             inConditionSlot && !inConditionSlot->GetConnections().empty())
@@ -1072,11 +1277,39 @@ namespace ConversationCanvas
             {
                 auto const sourceNode =
                     inConditionSlot->GetConnections().front()->GetSourceNode();
-                targetNodeDataDialogue->SetAvailabilityId(
-                    GetSymbolNameFromNode(sourceNode));
+
+                AZStd::vector<ConditionInstruction> code;
+                if (DialogueCondition condition;
+                    AppendConditionCode(sourceNode, code) &&
+                    condition.SetCode(AZStd::move(code)))
+                {
+                    targetNodeDataDialogue->SetCondition(
+                        AZStd::move(condition));
+                }
+                else
+                {
+                    targetNodeDataDialogue->SetAvailabilityId(
+                        GetSymbolNameFromNode(sourceNode));
+                    m_nodeDataTable[targetDialogueNode].m_availabilitySymbol =
+                        GetSymbolNameFromNode(sourceNode);
+                }
             }
         }
 
+        // A dialogue's script is the function connected to inScript. Without
+        // one, it's the function sharing the dialogue's symbol, which is what
+        // scripts were looked up by before they had an index.
+        m_nodeDataTable[targetDialogueNode].m_scriptSymbol =
+            GetSymbolNameFromNode(targetDialogueNode);
+        if (auto const inScriptSlot = targetDialogueNode->GetSlot(
+                ToString(DialogueNodeSlots::in_script));
+            inScriptSlot && inScriptSlot->GetConnections().size() == 1)
+        {
+            m_nodeDataTable[targetDialogueNode].m_scriptSymbol =
+                GetSymbolNameFromNode(
+                    inScriptSlot->GetConnections().front()->GetSourceNode());
+        }
+
         for (auto& [slotId, slot] : targetDialogueNode->GetSlots())
         {
             auto const value = GetValueFromSlotOrConnection(slot);
@@ -1466,6 +1699,7 @@ namespace ConversationCanvas
         m_includePaths.clear();
         m_classDefinitions.clear();
         m_functionDefinitions.clear();
+        m_functionSymbols.clear();
         m_slotValueTable.clear();
         m_startingIds.clear();
         m_nodeDataTable.clear();
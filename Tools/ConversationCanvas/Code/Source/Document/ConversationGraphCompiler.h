@@ -7,6 +7,7 @@
 #include "Conversation/UniqueId.h"
 #include "GraphModel/Model/Common.h"
 
+#include "Conversation/DialogueCondition.h"
 #include "Conversation/DialogueData.h"
 #include "NodeData.h"
 
@@ -131,6 +132,23 @@ namespace ConversationCanvas
         [[nodiscard]] auto GetAllNodesInExecutionOrder() const
             -> AZStd::vector<GraphModel::ConstNodePtr>;
 
+        /**
+         * @brief Appends the native code of the condition the node outputs.
+         *
+         * Only subgraphs made of nodes with a condition op setting can be
+         * compiled; anything else has to run as script.
+         *
+         * @returns False if some node in the subgraph can't be compiled.
+         */
+        [[nodiscard]] auto AppendConditionCode(
+            GraphModel::ConstNodePtr const& node,
+            AZStd::vector<Conversation::ConditionInstruction>& code,
+            size_t depth = 0) const -> bool;
+
+        //! Returns true if the node's condition is compiled to native code.
+        [[nodiscard]] auto IsNativeCondition(
+            GraphModel::ConstNodePtr const& node) const -> bool;
+
         /**
          * @brief Calls the build function responsible for generating the code
          * or asset for the given node.
@@ -205,6 +223,9 @@ namespace ConversationCanvas
         // Not currently implemented.
         AZStd::vector<AZStd::string> m_classDefinitions{};
         AZStd::vector<AZStd::string> m_functionDefinitions{};
+        // The symbol of each function in m_functionDefinitions. Their order
+        // is the order of the companion script's function table.
+        AZStd::vector<AZStd::string> m_functionSymbols{};
         /**
          * Holds the cached value of every node in the graph.
          *
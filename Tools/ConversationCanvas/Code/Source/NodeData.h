@@ -23,6 +23,9 @@ namespace ConversationCanvas
         AZStd::optional<Conversation::DialogueData> m_dialogue;
         AZStd::vector<AZ::Name> m_conditions;
         AZStd::vector<Conversation::UniqueId> m_responseIds;
+        // The symbols of the companion script functions the dialogue uses.
+        AZStd::string m_scriptSymbol;
+        AZStd::string m_availabilitySymbol;
         LinkData m_linkData;
     };
 } // namespace ConversationCanvas